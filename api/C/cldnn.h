@@ -114,10 +114,23 @@ typedef struct cldnn_program_impl* cldnn_program;
 /// @brief Executable network allocated from @ref cldnn_program
 typedef struct cldnn_network_impl* cldnn_network;
 
+/// @ingroup c_network
+/// @brief Set of networks allocated from @ref cldnn_program which execute requests concurrently
+typedef struct cldnn_pipeline_impl* cldnn_pipeline;
+
 /// @ingroup c_memory
 /// @brief Memory object
 typedef struct cldnn_memory_impl* cldnn_memory;
 
+/// @ingroup c_memory
+/// @brief Direction of the host access to locked memory.
+typedef enum /*:int32_t*/
+{
+    cldnn_lock_read_write,  ///< Memory is read and written.
+    cldnn_lock_read,        ///< Memory is only read, changes are not transferred back to the device.
+    cldnn_lock_write        ///< Whole memory is overwritten, its previous content is not transferred to the host.
+} cldnn_lock_mode;
+
 /// @addtogroup c_engine
 /// @{
 
@@ -161,6 +174,10 @@ typedef struct
     uint32_t enable_memory_pool;                        ///< Enables memory usage optimization. memory objects will be reused when possible. 
     void* context;
     const char* tuning_cache_path;                      ///< Enables defining other than default path to tuning cache json 
+    const char* kernels_cache_dir;                      ///< Specifies a directory where compiled OpenCL program binaries are cached between runs. Null/empty values means no caching.
+    uint16_t n_threads;                                 ///< Max number of host threads used to compile OpenCL programs and to run host primitives. 0 and 1 mean sequential compilation.
+    uint32_t enable_memory_planner;                     ///< Enables static planning of networks intermediate buffers into shared arenas (requires memory pool).
+    uint16_t n_queues;                                  ///< Number of in-order command queues over which independent branches of networks are distributed. 0 and 1 mean single queue.
 }  cldnn_engine_configuration;
 
 /// @brief Information about the engine returned by cldnn_get_engine_info().
@@ -194,6 +211,9 @@ typedef struct
 /// @brief user-defined event handler callback.
 typedef void(*cldnn_event_handler)(void*);
 
+/// @brief user-defined handler of finished pipeline request, called with status of the request.
+typedef void(*cldnn_request_handler)(cldnn_status, void*);
+
 /// @brief Profiling information for an executed network primitive.
 /// @details Every @ref cldnn_event associated with @ref cldnn_network_output.
 /// can contain one or more profiling information intervals.
@@ -213,7 +233,8 @@ typedef enum /*:int32_t*/
     cldnn_build_option_tuning_config,           ///< Tuning config.
     cldnn_build_option_graph_dumps_dir,         ///< Specifies a directory to which stages of network compilation should be dumped.
     cldnn_build_option_learning_config,         ///< User defined learning parameters.
-    cldnn_build_option_detection_output_gpu     ///< Run detection output layer always on GPU, regardless performance
+    cldnn_build_option_detection_output_gpu,    ///< Run detection output layer always on GPU, regardless performance
+    cldnn_build_option_kernel_selection_cache   ///< File with kernels selected by previous builds, imported before and exported after the build.
 } cldnn_build_option_type;
 
 /// @brief Tuning modes.
@@ -222,6 +243,7 @@ typedef enum /*:int32_t*/
     cldnn_tuning_disabled,          ///< Tuning is disabled.
     cldnn_tuning_use_cache,         ///< Tuning using the cached data (no on-line tuning for non-existing data).
     cldnn_tuning_tune_and_cache,    ///< Tuning using the cached data if exist, tune and update cache otherwise.
+    cldnn_tuning_cost_model,        ///< Kernels not found in the off-line cache are ranked by the cost model stored in the cache file path.
 } cldnn_tuning_mode_type;
 
 /// @brief Tuning config.
@@ -254,6 +276,13 @@ typedef struct
                                         ///< User should wait for the event before access this field.
 } cldnn_network_output;
 
+/// @brief Host memory of an input or output of pipeline request.
+typedef struct
+{
+    const char* id;                     ///< Primitive @p id of @p input_layout or network output.
+    void* data;                         ///< Host memory of the size of @ref cldnn_get_pipeline_layout.
+} cldnn_request_data;
+
 /// @}
 
 /// @addtogroup c_memory
@@ -680,6 +709,13 @@ CLDNN_API                 void cldnn_release_network(cldnn_network network, cldn
 /// by calling this function before call to cldnn_execute_network().
 CLDNN_API                 void cldnn_set_network_input(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status);
 
+/// @brief Makes the network write output of the primitive @p id directly into @p mem.
+/// @param[in] id Primitive @p id of a network output.
+/// @param[in] mem Memory object allocated on the network engine (e.g. by cldnn_allocate_host_memory()) which @p layout matches the output.
+/// @details The memory is used by next executions instead of the memory pool buffer, so the result is read from the host
+/// without copies on devices sharing memory with the host. Outputs computed in-place or in a buffer of another primitive can't be bound.
+CLDNN_API                 void cldnn_set_network_output_memory(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status);
+
 /// @brief Sets learning rate for training primitives in network.
 /// @param[in] lr Learning rate.
 CLDNN_API void cldnn_set_learning_rate(cldnn_network network, float lr, cldnn_status* status);
@@ -760,6 +796,32 @@ CLDNN_API cldnn_memory cldnn_get_network_output_memory(cldnn_network network, co
 /// @param name Output name to get the result.
 /// @returns @ref cldnn_event structure with the output information.
 CLDNN_API cldnn_event cldnn_get_network_output_event(cldnn_network network, const char* name, cldnn_status* status);
+
+/// @brief Allocates @p requests_num networks for specified @p program which execute requests concurrently.
+/// @details Uploads of inputs, execution and downloads of outputs of consecutive requests overlap.
+/// Every network has its own input, output and intermediate buffers.
+CLDNN_API       cldnn_pipeline cldnn_create_pipeline(cldnn_program program, uint32_t requests_num, cldnn_status* status);
+
+/// @brief Increment reference counter for the pipeline object.
+CLDNN_API                 void cldnn_retain_pipeline(cldnn_pipeline pipeline, cldnn_status* status);
+
+/// @brief Decrement reference counter for the pipeline object. Deletes object when counter becomes zero.
+/// @details Waits for all submitted requests.
+CLDNN_API                 void cldnn_release_pipeline(cldnn_pipeline pipeline, cldnn_status* status);
+
+/// @brief Returns layout of host memory of @p input_layout or output with @p id.
+CLDNN_API         cldnn_layout cldnn_get_pipeline_layout(cldnn_pipeline pipeline, cldnn_primitive_id id, cldnn_status* status);
+
+/// @brief Submits request which copies @p inputs to the device, executes the network and copies outputs to @p outputs.
+/// @details Function returns when the inputs are copied, so their memory can be reused. It blocks when all
+/// requests of the pipeline are in flight. @p handler is called from a worker thread when the outputs are copied.
+/// Handler shouldn't block, e.g. by submitting a request or waiting for the pipeline.
+/// @param handler Handler of finished request, can be null.
+/// @param param Parameter passed to the @p handler.
+CLDNN_API                 void cldnn_submit_pipeline_request(cldnn_pipeline pipeline, const cldnn_request_data* inputs, size_t inputs_num, const cldnn_request_data* outputs, size_t outputs_num, cldnn_request_handler handler, void* param, cldnn_status* status);
+
+/// @brief Waits until all submitted requests are finished and their handlers returned.
+CLDNN_API                 void cldnn_wait_pipeline(cldnn_pipeline pipeline, cldnn_status* status);
 /// @}
 
 /// @addtogroup c_memory
@@ -770,6 +832,14 @@ CLDNN_API cldnn_memory cldnn_allocate_memory(cldnn_engine engine, cldnn_layout l
 /// @brief Create memory object attached to the buffer allocated by user.
 /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
 CLDNN_API cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
+/// @brief Allocate memory on @p engine which is visible to the host without copies on devices sharing memory with the host.
+/// @details Such memory passed to cldnn_set_network_input() or cldnn_set_network_output_memory() is used directly by the network.
+CLDNN_API cldnn_memory cldnn_allocate_host_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status);
+/// @brief Create memory object on @p engine which uses the buffer allocated by user as its storage (without copies on devices sharing memory with the host).
+/// @details @p pointer has to be aligned to 4096 bytes.
+/// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+/// Content of the buffer is valid only when the memory object is locked.
+CLDNN_API cldnn_memory cldnn_attach_host_memory(cldnn_engine engine, cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
 /// @brief Checks if two memory objects refer to the same underlaying buffer.
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status);
 /// @brief Increment reference counter for the memory object.
@@ -779,7 +849,11 @@ CLDNN_API void cldnn_release_memory(cldnn_memory memory, cldnn_status* status);
 /// @brief Locks memory buffer. Provides direct access to memory data.
 /// @returns Direct pointer to the memory data.
 CLDNN_API void* cldnn_lock_memory(cldnn_memory memory, cldnn_status* status);
-/// @brief Unlocks memory locked by cldnn_lock_memory(cldnn_memory memory, cldnn_status* status).
+/// @brief Locks memory buffer for the access specified by @p mode (#cldnn_lock_mode).
+/// @details Nested locks have to use the same mode, unless the memory is locked with #cldnn_lock_read_write.
+/// @returns Direct pointer to the memory data.
+CLDNN_API void* cldnn_lock_memory_mode(cldnn_memory memory, int32_t mode, cldnn_status* status);
+/// @brief Unlocks memory locked by cldnn_lock_memory(cldnn_memory memory, cldnn_status* status) or cldnn_lock_memory_mode().
 CLDNN_API void cldnn_unlock_memory(cldnn_memory memory, cldnn_status* status);
 /// @brief Returns memory layout
 /// @returns @ref cldnn_layout which describes memory.
@@ -793,6 +867,10 @@ CLDNN_API uint16_t cldnn_float_to_half(float,cldnn_status*);
 /// @brief converts  half_t(f16 bit) to float(32 bit) 
 /// @returns 32bit float
 CLDNN_API float cldnn_half_to_float(uint16_t, cldnn_status*);
+/// @brief converts @p count floats(32 bit) from @p src to half_t(16 bit) in @p dst, uses F16C instructions if the CPU supports them.
+CLDNN_API void cldnn_float_to_half_array(const float* src, uint16_t* dst, size_t count, cldnn_status*);
+/// @brief converts @p count half_t(16 bit) from @p src to floats(32 bit) in @p dst, uses F16C instructions if the CPU supports them.
+CLDNN_API void cldnn_half_to_float_array(const uint16_t* src, float* dst, size_t count, cldnn_status*);
 
 /// @}
 
@@ -248,6 +248,33 @@ inline version_t get_version()
 
 /// @}
 
+/// @defgroup cpp_half Half Precision Conversions
+/// @{
+
+static_assert(sizeof(half_t) == sizeof(uint16_t), "half_t has to be 16 bit type");
+
+/// @brief Converts @p count floats from @p src to half precision in @p dst. Uses F16C instructions if the CPU supports them.
+inline void float_to_half(const float* src, half_t* dst, size_t count)
+{
+    check_status<void>("float_to_half: conversion failed",
+                       [&](status_t* status)
+                       {
+                           ::cldnn_float_to_half_array(src, reinterpret_cast<uint16_t*>(dst), count, status);
+                       });
+}
+
+/// @brief Converts @p count half precision values from @p src to floats in @p dst. Uses F16C instructions if the CPU supports them.
+inline void half_to_float(const half_t* src, float* dst, size_t count)
+{
+    check_status<void>("half_to_float: conversion failed",
+                       [&](status_t* status)
+                       {
+                           ::cldnn_half_to_float_array(reinterpret_cast<const uint16_t*>(src), dst, count, status);
+                       });
+}
+
+/// @}
+
 /// @cond CPP_HELPERS
 
 /// @defgroup cpp_helpers Helpers
@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "cldnn_defs.h"
+#include <algorithm>
+#include <thread>
 
 namespace cldnn
 {
@@ -68,6 +70,10 @@ struct engine_configuration
     bool enable_memory_pool;                    ///< Enables memory usage optimization. memory objects will be reused when possible (switched off for older drivers then NEO).
     void* context;              ///< Pointer to user context
     const std::string tuning_cache_path;        ///< Path to tuning kernel cache 
+    const std::string kernels_cache_dir;        ///< Specifies a directory where compiled OpenCL program binaries are cached between runs. Empty by default (means no caching).
+    const uint16_t n_threads;                   ///< Max number of host threads used to compile OpenCL programs and to run host primitives. Number of hardware threads by default.
+    bool enable_memory_planner;                 ///< Enables static planning of networks intermediate buffers into shared arenas (requires memory pool). Disabled by default.
+    uint16_t n_queues;                          ///< Number of in-order command queues over which independent branches of networks are distributed. 1 by default (single queue).
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -88,7 +94,11 @@ struct engine_configuration
             throttle_mode_types throttle_mode = throttle_mode_types::disabled,
             bool memory_pool = true,
             void* context = nullptr,
-            const std::string& tuning_cache_path = "cache.json")
+            const std::string& tuning_cache_path = "cache.json",
+            const std::string& kernels_cache_dir = std::string(),
+            uint16_t n_threads = static_cast<uint16_t>(std::max(std::thread::hardware_concurrency(), 1u)),
+            bool memory_planner = false,
+            uint16_t n_queues = 1)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -102,6 +112,10 @@ struct engine_configuration
         , enable_memory_pool(memory_pool)
         , context(context)
         , tuning_cache_path(tuning_cache_path)
+        , kernels_cache_dir(kernels_cache_dir)
+        , n_threads(n_threads)
+        , enable_memory_planner(memory_planner)
+        , n_queues(n_queues)
     {}
 
     engine_configuration(const cldnn_engine_configuration& c_conf)
@@ -118,6 +132,10 @@ struct engine_configuration
         , enable_memory_pool(c_conf.enable_memory_pool != 0)
         , context(c_conf.context)
 		, tuning_cache_path(c_conf.tuning_cache_path)
+        , kernels_cache_dir(c_conf.kernels_cache_dir ? c_conf.kernels_cache_dir : "")
+        , n_threads(c_conf.n_threads)
+        , enable_memory_planner(c_conf.enable_memory_planner != 0)
+        , n_queues(c_conf.n_queues)
     {}
 
     /// @brief Implicit conversion to C API @ref ::cldnn_engine_configuration
@@ -136,7 +154,11 @@ struct engine_configuration
             static_cast<int16_t>(throttle_mode),
             enable_memory_pool,
             context,
-            tuning_cache_path.c_str()
+            tuning_cache_path.c_str(),
+            kernels_cache_dir.c_str(),
+            n_threads,
+            enable_memory_planner,
+            n_queues
         };
     }
 };
@@ -186,7 +186,8 @@ struct lstm_gemm : public primitive_base<lstm_gemm, CLDNN_PRIMITIVE_DESC(lstm_ge
     /// @brief Constructs lstm layer.
     /// @param id This primitive id.
     /// @param input input primitive id.
-    /// @param input weights Primitive id containing weights data.
+    /// @param input weights Primitive id containing weights data. Provide empty string if the input is already multiplied by the weights
+    /// (input is then [batch, 1, 4 * hidden_size, 1] and it is added to the recurrent part as is).
     /// @param input recurrent Primitive id containing recurrent data. It is required even for no hidden values.
     /// @param input bias Primitive id containing bias data. Provide empty string if using lstm without bias.
     /// @param input hidden Primitive id containing hidden data. Provide empty string if using lstm without hidden values.
@@ -221,7 +222,7 @@ struct lstm_gemm : public primitive_base<lstm_gemm, CLDNN_PRIMITIVE_DESC(lstm_ge
     {
     }
 
-    /// @brief Primitive id containing weights data.
+    /// @brief Primitive id containing weights data. Empty if the input is already multiplied by the weights.
     primitive_id weights;
     /// @brief Primitive id containing recurrent data.
     primitive_id recurrent;
@@ -236,7 +237,8 @@ protected:
     std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override
     {
         std::vector<std::reference_wrapper<const primitive_id>> ret;
-        ret.push_back(weights);
+        if (!weights.empty())
+            ret.push_back(weights);
         ret.push_back(recurrent);
         if (!bias.empty())
             ret.push_back(bias);
@@ -35,6 +35,17 @@ namespace cldnn
 
 template<typename T> struct pointer;
 
+/// @brief Direction of the host access to locked @ref memory.
+enum class lock_mode : int32_t
+{
+    /// @brief Memory is read and written.
+    read_write = cldnn_lock_read_write,
+    /// @brief Memory is only read, changes are not transferred back to the device.
+    read = cldnn_lock_read,
+    /// @brief Whole memory is overwritten, its previous content is not transferred to the host.
+    write = cldnn_lock_write
+};
+
 namespace details { struct memory_c_to_cpp_converter; }
 
 /// @brief Represents buffer with particular @ref layout.
@@ -78,6 +89,39 @@ struct memory
         });
     }
 
+    /// Allocate memory on @p engine which is visible to the host without copies on devices sharing memory with the host.
+    /// @details Such memory passed to network::set_input_data() or network::set_output_memory() is used directly by the network.
+    static memory allocate_host(const engine& engine, const layout& layout)
+    {
+        size_t size = layout.bytes_count();
+        if (size == 0) throw std::invalid_argument("size should be more than 0");
+        return check_status<cldnn_memory>("host memory allocation failed", [&](status_t* status)
+        {
+            return cldnn_allocate_host_memory(engine.get(), layout, status);
+        });
+    }
+
+    /// Create memory object on @p engine which uses the buffer allocated by user as its storage.
+    /// @param ptr  The pointer to user allocated buffer, aligned to 4096 bytes.
+    /// @param size Size (in elements of T) of the buffer. Should be equal to @p layout.data_size()
+    /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+    /// Content of the buffer is valid only when the memory object is locked (see @ref pointer).
+    template<typename T>
+    static memory attach_host(const engine& engine, const cldnn::layout& layout, T* ptr, size_t size)
+    {
+        if (!ptr) throw std::invalid_argument("pointer should not be null");
+        size_t data_size = size * sizeof(T);
+        if (data_size != layout.bytes_count()) {
+            std::string err_str("buffer size mismatch - input size " + std::to_string(data_size) + " layout size " + std::to_string(layout.bytes_count()));
+            throw std::invalid_argument(err_str);
+        }
+
+        return check_status<cldnn_memory>("host memory attach failed", [&](status_t* status)
+        {
+            return cldnn_attach_host_memory(engine.get(), layout, ptr, data_size, status);
+        });
+    }
+
     memory(const memory& other)
         :_impl(other._impl), _layout(other._layout)
         ,_size(other._size), _count(other._count)
@@ -134,7 +178,7 @@ struct memory
 
     /// Creates the @ref pointer object to get an access memory data
     template<typename T> friend struct cldnn::pointer;
-    template<typename T> cldnn::pointer<T> pointer() const;
+    template<typename T> cldnn::pointer<T> pointer(lock_mode mode = lock_mode::read_write) const;
 
     /// C API memory handle
     cldnn_memory get() const { return _impl; }
@@ -172,13 +216,16 @@ private:
     }
 
     template<typename T>
-    T* lock() const
+    T* lock(lock_mode mode = lock_mode::read_write) const
     {
         if (data_type_traits::align_of(_layout.data_type) % alignof(T) != 0)
         {
             throw std::logic_error("memory data type alignment do not match");
         }
-        return check_status<T*>("memory lock failed", [=](status_t* status) { return static_cast<T*>(cldnn_lock_memory(_impl, status)); });
+        return check_status<T*>("memory lock failed", [=](status_t* status)
+        {
+            return static_cast<T*>(cldnn_lock_memory_mode(_impl, static_cast<int32_t>(mode), status));
+        });
     }
 
     void unlock() const
@@ -210,23 +257,25 @@ template<typename T>
 struct pointer
 {
     /// @brief Constructs pointer from @ref memory and locks @c (pin) ref@ memory object.
-    pointer(const memory& mem)
+    /// @param mode Access to the memory, @ref lock_mode::read and @ref lock_mode::write avoid transfers of data which is not needed.
+    pointer(const memory& mem, lock_mode mode = lock_mode::read_write)
         : _mem(mem)
+        , _mode(mode)
         , _size(_mem.size()/sizeof(T))
-        , _ptr(_mem.lock<T>())
+        , _ptr(_mem.lock<T>(mode))
     {}
 
     /// @brief Unlocks @ref memory
     ~pointer() { _mem.unlock(); }
 
     /// @brief Copy construction.
-    pointer(const pointer& other) : pointer(other._mem){}
+    pointer(const pointer& other) : pointer(other._mem, other._mode){}
 
     /// @brief Copy assignment.
     pointer& operator=(const pointer& other)
     {
         if (this->_mem != other._mem)
-            do_copy(other._mem);
+            do_copy(other._mem, other._mode);
         return *this;
     }
 
@@ -280,15 +329,17 @@ struct pointer
 
 private:
     memory _mem;
+    lock_mode _mode;
     size_t _size;
     T* _ptr;
 
     //TODO implement exception safe code.
-    void do_copy(const memory& mem)
+    void do_copy(const memory& mem, lock_mode mode)
     {
-        auto ptr = mem.lock<T>();
+        auto ptr = mem.lock<T>(mode);
         _mem.unlock();
         _mem = mem;
+        _mode = mode;
         _size = _mem.size() / sizeof(T);
         _ptr = ptr;
     }
@@ -296,7 +347,7 @@ private:
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template <typename T>
-pointer<T> memory::pointer() const { return cldnn::pointer<T>(*this); }
+pointer<T> memory::pointer(lock_mode mode) const { return cldnn::pointer<T>(*this, mode); }
 #endif
 
 /// @}
@@ -124,6 +124,12 @@ struct network
         check_status<void>("set network input failed", [&](status_t* status) { cldnn_set_network_input(_impl, id.c_str(), mem.get(), status); });
     }
 
+    /// @brief Makes the network write output of the primitive @p id directly into @p mem (e.g. allocated by memory::allocate_host()).
+    void set_output_memory(const primitive_id& id, const memory& mem) const
+    {
+        check_status<void>("set network output memory failed", [&](status_t* status) { cldnn_set_network_output_memory(_impl, id.c_str(), mem.get(), status); });
+    }
+
     /// @brief Sets learning rate for training primitives.
     void set_learning_rate(const float lr)
     {
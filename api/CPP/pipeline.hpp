@@ -0,0 +1,151 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cldnn_defs.h"
+#include "layout.hpp"
+#include "program.hpp"
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace cldnn
+{
+
+/// @addtogroup cpp_api C++ API
+/// @{
+
+/// @addtogroup cpp_network Network Execution
+/// @{
+
+/// @brief Executes requests of a @ref program concurrently on several networks allocated from it.
+/// @details Upload of inputs, execution and download of outputs of consecutive requests overlap.
+/// Every network has its own input, output and intermediate buffers.
+struct pipeline
+{
+    /// @brief Allocates networks for the pipeline.
+    /// @param program The program object which contains compiled primitives.
+    /// @param requests_num Number of requests which can be in flight at the same time.
+    pipeline(program const& program, uint32_t requests_num = 2)
+        :_impl(check_status<cldnn_pipeline>("pipeline allocation failed", [&](status_t* status)
+                {
+                    return cldnn_create_pipeline(program.get(), requests_num, status);
+                }))
+    {}
+
+    /// @brief Constructs pipeline from implicitly created program object. This is a shorthand for pipeline(program(engine, topology, options), requests_num)
+    pipeline(const engine& engine, const topology& topology, const build_options& options = build_options(), uint32_t requests_num = 2)
+        :pipeline(program(engine, topology, options), requests_num)
+    {}
+
+    /// @brief Constructs pipeline object from C API @ref cldnn_pipeline.
+    pipeline(cldnn_pipeline impl) :_impl(impl)
+    {
+        if (_impl == nullptr) throw std::invalid_argument("implementation pointer should not be null");
+    }
+
+    /// @brief Copy construction.
+    pipeline(const pipeline& other) :_impl(other._impl)
+    {
+        retain();
+    }
+
+    /// @brief Copy assignment.
+    pipeline& operator=(const pipeline& other)
+    {
+        if (_impl == other._impl) return *this;
+        release();
+        _impl = other._impl;
+        retain();
+        return *this;
+    }
+
+    /// @brief Releases wrapped C API @ref cldnn_pipeline. Last reference waits for all submitted requests.
+    ~pipeline()
+    {
+        release();
+    }
+
+    friend bool operator==(const pipeline& lhs, const pipeline& rhs) { return lhs._impl == rhs._impl; }
+    friend bool operator!=(const pipeline& lhs, const pipeline& rhs) { return !(lhs == rhs); }
+
+    /// @brief Returns layout of host memory of @ref input_layout or output with @p id.
+    layout get_layout(const primitive_id& id) const
+    {
+        return check_status<cldnn_layout>("get pipeline layout failed", [&](status_t* status) { return cldnn_get_pipeline_layout(_impl, id.c_str(), status); });
+    }
+
+    /// @brief Submits request which copies @p inputs to the device, executes the network and copies outputs to @p outputs.
+    /// @details Returns when the inputs are copied, so their memory can be reused. Blocks when all requests are in flight.
+    /// @returns Future which is ready when the outputs are copied.
+    std::future<void> submit(const std::map<primitive_id, const void*>& inputs, const std::map<primitive_id, void*>& outputs)
+    {
+        std::vector<cldnn_request_data> inputs_data;
+        for (const auto& input : inputs)
+            inputs_data.push_back({ input.first.c_str(), const_cast<void*>(input.second) });
+        std::vector<cldnn_request_data> outputs_data;
+        for (const auto& output : outputs)
+            outputs_data.push_back({ output.first.c_str(), output.second });
+
+        std::unique_ptr<std::promise<void>> promise(new std::promise<void>());
+        auto result = promise->get_future();
+        check_status<void>("submit pipeline request failed", [&](status_t* status)
+        {
+            cldnn_submit_pipeline_request(_impl, inputs_data.data(), inputs_data.size(), outputs_data.data(), outputs_data.size(),
+                                          request_finished, promise.get(), status);
+        });
+        promise.release();
+        return result;
+    }
+
+    /// @brief Waits until all submitted requests are finished.
+    void wait() const
+    {
+        check_status<void>("wait for pipeline failed", [&](status_t* status) { cldnn_wait_pipeline(_impl, status); });
+    }
+
+    /// @brief Returns wrapped C API @ref cldnn_pipeline handler.
+    cldnn_pipeline get() const { return _impl; }
+
+private:
+    cldnn_pipeline _impl;
+
+    static void request_finished(cldnn_status status, void* param)
+    {
+        std::unique_ptr<std::promise<void>> promise(static_cast<std::promise<void>*>(param));
+        if (status == CLDNN_SUCCESS)
+            promise->set_value();
+        else
+            promise->set_exception(std::make_exception_ptr(error("pipeline request failed", status)));
+    }
+
+    void retain()
+    {
+        check_status<void>("retain pipeline failed", [=](status_t* status) { cldnn_retain_pipeline(_impl, status); });
+    }
+    void release()
+    {
+        check_status<void>("release pipeline failed", [=](status_t* status) { cldnn_release_pipeline(_impl, status); });
+    }
+};
+CLDNN_API_CLASS(pipeline)
+/// @}
+/// @}
+}
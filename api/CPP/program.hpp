@@ -63,7 +63,12 @@ enum class build_option_type
     tuning_config = cldnn_build_option_tuning_config,
 
     /// @brief Specifies a directory to which stages of network compilation should be dumped. (default: empty, i.e. no dumping)
-    graph_dumps_dir = cldnn_build_option_graph_dumps_dir
+    graph_dumps_dir = cldnn_build_option_graph_dumps_dir,
+
+    /// @brief Specifies a file with kernels selected for the program (default: empty, i.e. kernels are always selected from scratch).
+    /// @details Kernels selected for every primitive are exported to the file after the build. When the file exists, the build
+    /// imports it first and generates only the recorded kernel for a primitive instead of evaluating all implementations.
+    kernel_selection_cache = cldnn_build_option_kernel_selection_cache
 
 };
 
@@ -77,7 +82,11 @@ enum class tuning_mode
     tuning_use_cache = cldnn_tuning_use_cache,
 
     /// @brief Tuning using the cached data if exist, tune and update cache otherwise.
-    tuning_tune_and_cache = cldnn_tuning_tune_and_cache
+    tuning_tune_and_cache = cldnn_tuning_tune_and_cache,
+
+    /// @brief Kernels not found in the off-line cache are ranked by the cost model stored in the cache file path, without running them.
+    /// @details The model is trained by cost_model_gen.py from the samples written by @ref tuning_tune_and_cache next to its cache file.
+    tuning_cost_model = cldnn_tuning_cost_model
 };
 
 /// @brief Tuning configuration.
@@ -137,6 +146,13 @@ struct build_option
     /// @brief User defined learning parameters.
     static std::shared_ptr<const build_option> learning_config(const learning_params& params = learning_params());
 
+    /// @brief Specifies a file to which kernels selected for the program are exported and from which they are imported
+    /// by next builds of the same topology (default: empty, i.e. no caching).
+    /// @details Selection is recorded per primitive parameters, so the file can be shared by different topologies.
+    /// Entries recorded for a different device, driver or clDNN version are ignored.
+    /// Compiled program binaries are cached separately, see @ref engine_configuration::kernels_cache_dir.
+    static std::shared_ptr<const build_option> kernel_selection_cache(const std::string& file_path);
+
     virtual ~build_option() = default;
 
 private:
@@ -353,6 +369,43 @@ private:
     }
 };
 
+/// @brief @ref build_option specialization for selecting a file.
+template<build_option_type OptType>
+struct build_option_file : build_option
+{
+    const std::string file_path;
+
+    /// @brief Constructs option.
+    /// @param file_path Path to the file.
+    explicit build_option_file(const std::string& file_path)
+        : file_path(file_path)
+    {}
+
+    /// @brief Constructs from C API @ref ::cldnn_build_option.
+    explicit build_option_file(const cldnn_build_option& value)
+        : file_path(from_c_value(value))
+    {}
+
+private:
+    /// @brief Returns @p OptType.
+    build_option_type get_type() const override { return OptType; }
+    /// @brief Returns null terminated C string.
+    const void* get_data() const override { return (file_path.empty() ? nullptr : file_path.c_str()); }
+
+    build_option_file(const build_option_file& other) = delete;
+    build_option_file& operator=(const build_option_file& other) = delete;
+
+    static std::string from_c_value(const cldnn_build_option& value)
+    {
+        if (value.type != static_cast<int32_t>(OptType))
+            throw std::invalid_argument("option type does not match");
+        if (value.data == nullptr)
+            return{};
+
+        return{ static_cast<const char*>(value.data) };
+    }
+};
+
 namespace detail
 {
     /// @brief Helper template to convert @ref build_option_type value to particular @ref build_option class.
@@ -448,6 +501,16 @@ namespace detail
             return std::make_shared<object_type>(option);
         }
     };
+    template<> struct build_option_traits<build_option_type::kernel_selection_cache>
+    {
+        typedef build_option_file<build_option_type::kernel_selection_cache> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::kernel_selection_cache({}); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_kernel_selection_cache);
+            return std::make_shared<object_type>(option);
+        }
+    };
 
 #endif
 } // namespace detail
@@ -493,6 +556,11 @@ inline std::shared_ptr<const build_option> build_option::graph_dumps_dir(const s
     return std::make_shared<build_option_directory<build_option_type::graph_dumps_dir>>(dir_path);
 }
 
+inline std::shared_ptr<const build_option> build_option::kernel_selection_cache(const std::string& file_path)
+{
+    return std::make_shared<build_option_file<build_option_type::kernel_selection_cache>>(file_path);
+}
+
 #endif
 
 /// @brief Represents program build options list.
@@ -592,6 +660,8 @@ private:
             return detail::build_option_traits<build_option_type::tuning_config>::make_option(option);
         case cldnn_build_option_graph_dumps_dir:
             return detail::build_option_traits<build_option_type::graph_dumps_dir>::make_option(option);
+        case cldnn_build_option_kernel_selection_cache:
+            return detail::build_option_traits<build_option_type::kernel_selection_cache>::make_option(option);
         default: throw std::out_of_range("unsupported build option type");
         }
     }
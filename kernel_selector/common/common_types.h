@@ -58,6 +58,7 @@ namespace kernel_selector
         FULLY_CONNECTED_GRAD_WEIGHTS,
         LSTM_GEMM,
         LSTM_ELT,
+        LSTM_SEQUENCE,
         EMBED,
         SOFT_MAX_LOSS_GRAD,
         BORDER,
@@ -70,6 +71,7 @@ namespace kernel_selector
 
         CONTRACT,
         ONE_HOT,
+        CONDITION,
  		DETECTION_OUTPUT    
 	};
 
@@ -415,7 +417,8 @@ namespace kernel_selector
     {
         TUNING_DISABLED,        // Tuning is disabled.
         TUNING_USE_CACHE,       // Tuning using the cached data (no on-line tuning for non-existing data).
-        TUNING_TUNE_AND_CACHE   // Tuning using the cached data if exist, tune and update cache otherwise.attention_params
+        TUNING_TUNE_AND_CACHE,  // Tuning using the cached data if exist, tune and update cache otherwise.attention_params
+        TUNING_COST_MODEL       // Kernels not found in the off-line cache are ranked by the cost model from the cache file.
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +427,16 @@ namespace kernel_selector
     using uSize  = Size<std::uint32_t>;
     using stSize = Size<std::size_t>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ConditionFunction
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class ConditionFunction
+    {
+        EQUAL,
+        GREATER,
+        LESS,
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // ContractMode
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
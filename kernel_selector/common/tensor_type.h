@@ -24,6 +24,7 @@
 #include <cstddef>
 #include <algorithm>
 #include <array>
+#include <stdexcept>
 
 namespace kernel_selector
 {
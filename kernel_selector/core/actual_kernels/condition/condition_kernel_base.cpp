@@ -0,0 +1,82 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "condition_kernel_base.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        size_t GetLocalWorkSize(const condition_params& params)
+        {
+            const size_t maxLws = params.engineInfo.maxWorkGroupSize ? static_cast<size_t>(params.engineInfo.maxWorkGroupSize) : 256;
+            return std::max<size_t>(1, std::min(params.inputs[1].LogicalSize(), maxLws));
+        }
+    }
+
+    JitConstants ConditionKernelBase::GetJitConstants(const condition_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        std::string compare;
+        switch (params.function)
+        {
+        case ConditionFunction::EQUAL:   compare = "((a) == (b))"; break;
+        case ConditionFunction::GREATER: compare = "((a) > (b))"; break;
+        case ConditionFunction::LESS:    compare = "((a) < (b))"; break;
+        default: break;
+        }
+
+        jit.AddConstants({
+            MakeJitConstant("COMPARE(a, b)", compare),
+            MakeJitConstant("OFFSET", params.offset),
+            MakeJitConstant("COMPARE_ELEMENTS", params.inputs[1].LogicalSize()),
+            MakeJitConstant("LOCAL_SIZE", GetLocalWorkSize(params)),
+        });
+
+        return jit;
+    }
+
+    KernelsData ConditionKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const condition_params& orgParams = static_cast<const condition_params&>(params);
+
+        KernelData kd = KernelData::Default<condition_params>(params);
+
+        // the compare tensor is usually tiny, a single work group reduces it without a second pass
+        const size_t lws = GetLocalWorkSize(orgParams);
+
+        auto& kernel = kd.kernels[0];
+        auto cldnnJit = GetJitConstants(orgParams);
+        auto entryPoint = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
+
+        kernel.workGroups.global = { lws, 1, 1 };
+        kernel.workGroups.local = { lws, 1, 1 };
+        kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
+        kernel.arguments = GetArgsDesc(2, false, false);
+
+        kd.estimatedTime = estimated_time;
+
+        return{ kd };
+    }
+}
@@ -83,4 +83,9 @@ namespace kernel_selector {
             kd[0].estimatedTime = FORCE_PRIORITY_4;
         return kd;
     }
+
+    float ConvolutionKernel_MMAD::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_4 : NOT_SUPPORTED;
+    }
 }
\ No newline at end of file
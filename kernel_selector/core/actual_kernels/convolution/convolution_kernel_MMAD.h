@@ -28,6 +28,7 @@ namespace kernel_selector {
         virtual ~ConvolutionKernel_MMAD() {}
 
         virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual float GetKernelsPriority(const Params& params, const optional_params& options) const override;
         virtual ParamsKey GetSupportedKey() const override;
 
     protected:
@@ -263,6 +263,11 @@ namespace kernel_selector
         return kd;
     }
 
+    float ConvolutionKernel_MMAD_blocks::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_2 : NOT_SUPPORTED;
+    }
+
     KernelsData ConvolutionKernel_MMAD_blocks::GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const
     {
         if (!Validate(params, options))
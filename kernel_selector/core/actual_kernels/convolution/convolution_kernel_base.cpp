@@ -228,6 +228,22 @@ namespace kernel_selector
         return kd;
     }
 
+    float ConvolutionKernelBase::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return NOT_SUPPORTED;
+        }
+
+        // same dispatch data as in GetCommonKernelsData, without weights reorder and jit
+        convolution_params newParams = static_cast<const convolution_params&>(params);
+        if (NeedPaddedInput())
+        {
+            CovolutionUpdateInputParams(newParams);
+        }
+        return SetDefault(newParams).effiency;
+    }
+
     KernelsData ConvolutionKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, const std::string exeMode, int autoTuneIndex) const
     {
         if (!Validate(params, options))
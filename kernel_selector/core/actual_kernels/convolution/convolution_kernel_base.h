@@ -61,6 +61,7 @@ namespace kernel_selector
         std::vector<std::string> autoTuneOptions = { DEFAULT, NO_PRERA_SCH, AGE_BASED };
         virtual KernelsData GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const override;
         virtual KernelsData GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, int autoTuneIndex = -1) const override;
+        virtual float GetKernelsPriority(const Params& params, const optional_params& options) const override;
     
     protected:
         virtual std::vector<WeightsLayout> GetSupportedWeightLayouts(const convolution_params&) const = 0;
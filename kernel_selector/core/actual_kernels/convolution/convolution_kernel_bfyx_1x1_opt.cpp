@@ -170,4 +170,9 @@ namespace kernel_selector
         return kd;
     }
 
+    float convolution_kernel_bfyx_1x1_opt::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_1 : NOT_SUPPORTED;
+    }
+
 }
\ No newline at end of file
@@ -94,4 +94,9 @@ namespace kernel_selector {
             kd[0].estimatedTime = FORCE_PRIORITY_3;
         return kd;
     }
+
+    float ConvolutionKernel_byx8_f4__fs_bs_yx_bsv4_fsv32::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_3 : NOT_SUPPORTED;
+    }
 }
\ No newline at end of file
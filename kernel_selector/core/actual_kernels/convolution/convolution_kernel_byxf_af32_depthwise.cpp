@@ -64,4 +64,9 @@ namespace kernel_selector {
             kd[0].estimatedTime = FORCE_PRIORITY_3;
         return kd;
     }
+
+    float ConvolutionKernel_byxf_af32_depthiwise::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_3 : NOT_SUPPORTED;
+    }
 }
\ No newline at end of file
@@ -28,6 +28,7 @@ namespace kernel_selector {
         virtual ~ConvolutionKernel_byxf_af32_depthiwise() {}
 
         virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual float GetKernelsPriority(const Params& params, const optional_params& options) const override;
         virtual ParamsKey GetSupportedKey() const override;
 
     protected:
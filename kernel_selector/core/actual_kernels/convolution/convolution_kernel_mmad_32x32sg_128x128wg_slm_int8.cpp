@@ -184,4 +184,9 @@ namespace kernel_selector {
 			kd[0].estimatedTime = FORCE_PRIORITY_1; //_3 
 		return kd;
 	}
+
+	float ConvolutionKernel_mmad_32x32sg_128x128wg_slm_int8::GetKernelsPriority(const Params& params, const optional_params& options) const
+	{
+		return Validate(params, options) ? FORCE_PRIORITY_1 : NOT_SUPPORTED;
+	}
 }
@@ -29,6 +29,7 @@ namespace kernel_selector {
 		virtual ~ConvolutionKernel_mmad_32x32sg_224x128wg_slm_int8() {}
 
 		virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+		virtual float GetKernelsPriority(const Params& params, const optional_params& options) const override;
 		virtual ParamsKey GetSupportedKey() const override;
 
 	protected:
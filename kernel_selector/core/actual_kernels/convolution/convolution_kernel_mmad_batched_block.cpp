@@ -167,4 +167,9 @@ namespace kernel_selector {
             kd[0].estimatedTime = FORCE_PRIORITY_5;
         return kd;
     }
+
+    float ConvolutionKernel_mmad_batched_block::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_5 : NOT_SUPPORTED;
+    }
 }
\ No newline at end of file
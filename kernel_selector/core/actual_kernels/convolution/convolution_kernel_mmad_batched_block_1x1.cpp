@@ -172,4 +172,9 @@ namespace kernel_selector {
             kd[0].estimatedTime = FORCE_PRIORITY_3;
         return kd;
     }
+
+    float ConvolutionKernel_mmad_batched_block_1x1::GetKernelsPriority(const Params& params, const optional_params& options) const
+    {
+        return Validate(params, options) ? FORCE_PRIORITY_3 : NOT_SUPPORTED;
+    }
 }
\ No newline at end of file
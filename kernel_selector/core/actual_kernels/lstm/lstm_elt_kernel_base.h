@@ -44,7 +44,7 @@ namespace kernel_selector
         uint32_t direction = 0;
         uint32_t cell_direction = 0;
 
-        size_t GetOffsetIndex(order_type type, size_t idx) const {
+        static size_t GetOffsetIndex(order_type type, size_t idx) {
             static const std::map<order_type, std::vector<size_t>> offset_map {
                 {offset_iofz, {0, 1, 2, 3}},
                 {offset_ifoz, {0, 2, 1, 3}},
@@ -37,7 +37,11 @@ namespace kernel_selector
                 MakeJitConstant("HIDDEN_DIRECTION", params.hidden_direction)
             });
         }
-        jit.AddConstants({ MakeJitConstant("WEIGHTS", weights)});
+        if (params.projectedInput) {
+            jit.AddConstants({ MakeJitConstant("PROJECTED_INPUT", true) });
+        } else {
+            jit.AddConstants({ MakeJitConstant("WEIGHTS", weights)});
+        }
         jit.AddConstants({ MakeJitConstant("DIRECTION", params.direction)});
         jit.AddConstants({ MakeJitConstant("INPUT_DIRECTION", params.input_direction)});
 
@@ -72,7 +76,9 @@ namespace kernel_selector
         kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
         kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
-        kernel.arguments.push_back({ ArgumentDescriptor::Types::WEIGHTS, 0 });
+        if (!orgParams.projectedInput) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::WEIGHTS, 0 });
+        }
         if (orgParams.hasHidden) {
             kernel.arguments.push_back({ ArgumentDescriptor::Types::HIDDEN, 0 });
             kernel.arguments.push_back({ ArgumentDescriptor::Types::RECURRENT, 0 });
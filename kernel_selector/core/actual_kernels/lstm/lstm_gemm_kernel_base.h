@@ -34,6 +34,7 @@ namespace kernel_selector
         DataTensor hidden;
         bool hasBias = false;
         bool hasHidden = false;
+        bool projectedInput = false;    // input is already multiplied by the weights, the weights are not used
         uint32_t direction = 0;
         uint32_t input_direction = 0; // for bidirectional node fusion in stacked LSTMs
         uint32_t hidden_direction = 0;
@@ -62,6 +63,11 @@ namespace kernel_selector
                 k.EnableLSTMGEMMHidden();
             }
 
+            if (projectedInput)
+            {
+                k.EnableLSTMGEMMProjectedInput();
+            }
+
             return k;
         }
     };
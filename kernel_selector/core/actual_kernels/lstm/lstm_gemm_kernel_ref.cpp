@@ -34,6 +34,7 @@ namespace kernel_selector {
         k.EnableBatching();
         k.EnableLSTMGEMMBias();
         k.EnableLSTMGEMMHidden();
+        k.EnableLSTMGEMMProjectedInput();
         return k;
     }
 
@@ -32,6 +32,7 @@ namespace kernel_selector {
         k.EnableBatching();
         k.EnableLSTMGEMMBias();
         k.EnableLSTMGEMMHidden();
+        k.EnableLSTMGEMMProjectedInput();
         k.EnableSubGroup();
         return k;
     }
@@ -43,13 +44,15 @@ namespace kernel_selector {
 
         // This kernel is good if 
         // 1) Batch size is 1
-        // 2) The input size y-x size is 64x1
+        // 2) The input size y-x size is 64x1 (the hidden size if the input is already projected)
         const lstm_gemm_params& orgParams = static_cast<const lstm_gemm_params&>(params);
         const auto& input = orgParams.inputs[0];
+        const auto& gemvInput = orgParams.projectedInput ? orgParams.hidden : input;
 
         if (   (input.Batch().v == 1) 
-            && (input.X().v >= 64) 
-            && (input.Y().v == 1)) 
+            && (!orgParams.projectedInput || orgParams.hasHidden)
+            && (gemvInput.X().v >= 64) 
+            && (gemvInput.Y().v == 1)) 
         {    
             auto out = orgParams.output;
 
@@ -0,0 +1,154 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_sequence_kernel_base.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        size_t GetLocalWorkSize(const lstm_sequence_params& params)
+        {
+            const size_t gates = params.recurrent.Y().v;
+            const size_t maxLws = params.engineInfo.maxWorkGroupSize ? static_cast<size_t>(params.engineInfo.maxWorkGroupSize) : 256;
+            return std::max<size_t>(1, std::min(gates, maxLws));
+        }
+    }
+
+    JitConstants LSTMSequenceKernelBase::GetJitConstants(const lstm_sequence_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        const size_t hiddenSize = params.recurrent.X().v;
+        const size_t lws = GetLocalWorkSize(params);
+        jit.AddConstants({
+            MakeJitConstant("RECURRENT", params.recurrent),
+            MakeJitConstant("STATE_SIZE", hiddenSize),
+            MakeJitConstant("GATES_SIZE", 4 * hiddenSize),
+            MakeJitConstant("SEQUENCE_LENGTH", params.inputs[0].Feature().v),
+            MakeJitConstant("LOCAL_SIZE", lws),
+            MakeJitConstant("CELLS_PER_ITEM", CeilDiv(hiddenSize, lws)),
+        });
+
+        if (params.projectedInput) {
+            jit.AddConstants({ MakeJitConstant("PROJECTED_INPUT", true), MakeJitConstant("INPUT_DIRECTIONS", params.inputDirections) });
+        } else {
+            jit.AddConstants({ MakeJitConstant("WEIGHTS", params.weights), MakeJitConstant("INPUT_DIRECTIONS", params.inputs[0].Y().v) });
+        }
+        if (params.hasBias) {
+            jit.AddConstants({ MakeJitConstant("BIAS", params.bias), MakeJitConstant("BIAS_TERM", true) });
+        }
+        if (params.hasHidden) {
+            jit.AddConstants({ MakeJitConstant("INITIAL_HIDDEN", params.hidden), MakeJitConstant("INITIAL_HIDDEN_TERM", true) });
+        }
+        if (params.hasCell) {
+            jit.AddConstants({ MakeJitConstant("INITIAL_CELL", params.cell), MakeJitConstant("INITIAL_CELL_TERM", true) });
+        }
+        if (params.clip > 0) {
+            std::string psclip = toCodeString(params.clip);
+            std::string nsclip = toCodeString(-params.clip);
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "((x > " + psclip + ") ? " +
+                psclip + ": (x < " + nsclip + ") ? " + nsclip + " : (x))") });
+        }
+        else {
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "(x)") });
+        }
+        if (params.input_forget) {
+            jit.AddConstants({ MakeJitConstant("INPUT_FORGET", true) });
+        }
+        if (params.emitSequence) {
+            jit.AddConstants({ MakeJitConstant("EMIT_SEQUENCE", true) });
+        }
+        if (params.emitLastCell) {
+            jit.AddConstants({ MakeJitConstant("EMIT_LAST_CELL", true) });
+        }
+
+        jit.AddConstants({
+            MakeJitConstant("GEMM_OFFSET_I", lstm_elt_params::GetOffsetIndex(params.gate_order, 0) * hiddenSize),
+            MakeJitConstant("GEMM_OFFSET_O", lstm_elt_params::GetOffsetIndex(params.gate_order, 1) * hiddenSize),
+            MakeJitConstant("GEMM_OFFSET_F", lstm_elt_params::GetOffsetIndex(params.gate_order, 2) * hiddenSize),
+            MakeJitConstant("GEMM_OFFSET_Z", lstm_elt_params::GetOffsetIndex(params.gate_order, 3) * hiddenSize),
+        });
+        return jit;
+    }
+
+    bool LSTMSequenceKernelBase::Validate(const Params& p, const optional_params&) const
+    {
+        if (p.GetType() != KernelType::LSTM_SEQUENCE)
+        {
+            return false;
+        }
+
+        const lstm_sequence_params& params = static_cast<const lstm_sequence_params&>(p);
+
+        // gates and hidden state of a step, accumulated in float
+        const size_t hiddenSize = params.recurrent.X().v;
+        const size_t localMemory = 5 * hiddenSize * sizeof(float);
+        if (hiddenSize == 0 || params.recurrent.Y().v != 4 * hiddenSize || localMemory > params.engineInfo.maxLocalMemSize)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    KernelsData LSTMSequenceKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const lstm_sequence_params& orgParams = static_cast<const lstm_sequence_params&>(params);
+
+        KernelData kd = KernelData::Default<lstm_sequence_params>(params, orgParams.inputs.size());
+
+        float effiency = FORCE_PRIORITY_1;
+        const size_t lws = GetLocalWorkSize(orgParams);
+        const size_t directions = orgParams.recurrent.Feature().v;
+
+        auto& kernel = kd.kernels[0];
+        auto cldnnJit = GetJitConstants(orgParams);
+        auto entryPoint = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
+
+        // a work group per batch and direction, the steps run sequentially inside of it
+        kernel.workGroups.global = { lws, orgParams.output.Batch().v, directions };
+        kernel.workGroups.local = { lws, 1, 1 };
+        kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
+        if (!orgParams.projectedInput) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::WEIGHTS, 0 });
+        }
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::RECURRENT, 0 });
+        if (orgParams.hasBias) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::BIAS, 0 });
+        }
+        if (orgParams.hasHidden) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::HIDDEN, 0 });
+        }
+        if (orgParams.hasCell) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::CELL, 0 });
+        }
+
+        kd.estimatedTime = effiency;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,124 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+#include "lstm_elt_kernel_base.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // lstm_sequence_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct lstm_sequence_params : public base_params
+    {
+        lstm_sequence_params() : base_params(KernelType::LSTM_SEQUENCE) {}
+
+        DataTensor weights;
+        DataTensor recurrent;
+        DataTensor bias;
+        DataTensor hidden;      // initial hidden state
+        DataTensor cell;        // initial cell state
+        bool hasBias = false;
+        bool hasHidden = false;
+        bool hasCell = false;
+        lstm_elt_params::order_type gate_order = lstm_elt_params::offset_iofz;
+        float clip = 0;
+        bool input_forget = false;
+        bool emitSequence = true;   // hidden state of every step, otherwise of the last step only
+        bool emitLastCell = false;  // cell state of the last step after the hidden states
+        bool projectedInput = false;    // input is already multiplied by the weights with the bias added, the weights are not used
+        uint32_t inputDirections = 1;   // directions of the input the projection was computed from
+
+        void SetBias(const DataTensor& v) {
+            bias = v;
+            hasBias = true;
+        }
+
+        void SetHidden(const DataTensor& v) {
+            hidden = v;
+            hasHidden = true;
+        }
+
+        void SetCell(const DataTensor& v) {
+            cell = v;
+            hasCell = true;
+        }
+
+        void SetOffsetOrder(int32_t t) {
+            gate_order = static_cast<lstm_elt_params::order_type>(t);
+        }
+
+        virtual ParamsKey GetParamsKey() const override
+        {
+            ParamsKey k = base_params::GetParamsKey();
+
+            if (hasBias)
+            {
+                k.EnableLSTMSequenceBias();
+            }
+
+            if (hasHidden)
+            {
+                k.EnableLSTMSequenceHidden();
+            }
+
+            if (hasCell)
+            {
+                k.EnableLSTMSequenceCell();
+            }
+
+            if (projectedInput)
+            {
+                k.EnableLSTMSequenceProjectedInput();
+            }
+
+            return k;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // lstm_sequence_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct lstm_sequence_optional_params : optional_params
+    {
+        lstm_sequence_optional_params() : optional_params(KernelType::LSTM_SEQUENCE) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // LSTMSequenceKernelBase
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Runs all the steps of an lstm layer in a single kernel instead of a pair of lstm_gemm and lstm_elt kernels per
+    // step. One work group processes the whole sequence of a batch and direction: the gates and the hidden state of the
+    // current step stay in local memory and the cell state stays in registers.
+    class LSTMSequenceKernelBase : public common_kernel_base
+    {
+    public:
+        using common_kernel_base::common_kernel_base;
+        virtual ~LSTMSequenceKernelBase() {}
+
+        struct DispatchData : public CommonDispatchData
+        {};
+
+    protected:
+        virtual JitConstants GetJitConstants(const lstm_sequence_params& params) const;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params& optParams) const;
+
+        bool Validate(const Params& p, const optional_params& o) const override;
+    };
+}
@@ -19,6 +19,14 @@
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <cstdio>
+#include <algorithm>
+#include <thread>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 #include "istreamwrapper.h"
 #include "stringbuffer.h"
 #include "prettywriter.h"
@@ -26,81 +34,392 @@
 
 namespace kernel_selector
 {
-    std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode, const std::string& cacheFilePath, const uint32_t computeUnitsCount,  const std::string& hash)
+    namespace
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        rapidjson::Document cacheData;
+        // Entry of the tuning cache: [implementation name, tune index, { statistics and descriptor }]
+        bool ReadDescriptor(const rapidjson::Value& prog, TuningDescriptor& descriptor)
+        {
+            if (prog.Size() < 3 || !prog[2].IsObject() || !prog[2].HasMember("descriptor"))
+                return false;
+
+            const rapidjson::Value& value = prog[2]["descriptor"];
+            if (!value.IsObject() || !value.HasMember("kernel_type") || !value["kernel_type"].IsString() ||
+                !value.HasMember("features") || !value["features"].IsArray())
+                return false;
+
+            descriptor.kernelType = value["kernel_type"].GetString();
+            descriptor.features.clear();
+            for (const auto& feature : value["features"].GetArray())
+            {
+                if (!feature.IsNumber())
+                    return false;
+                descriptor.features.push_back(static_cast<float>(feature.GetDouble()));
+            }
+            return true;
+        }
+
+        class NearestKernels
+        {
+        public:
+            NearestKernels(const TuningDescriptor& descriptor, size_t maxCount) : descriptor(descriptor), maxCount(maxCount) {}
+
+            void Add(const TuningDescriptor& other, const std::string& implementationName, int tuneIndex)
+            {
+                if (descriptor.Compatible(other))
+                    kernels.emplace_back(descriptor.Distance(other), std::make_tuple(implementationName, tuneIndex));
+            }
+
+            AutoTuner::CachedKernels Get()
+            {
+                std::stable_sort(kernels.begin(), kernels.end(),
+                    [](const std::pair<float, std::tuple<std::string, int>>& a, const std::pair<float, std::tuple<std::string, int>>& b)
+                    { return a.first < b.first; });
+
+                AutoTuner::CachedKernels result;
+                for (size_t i = 0; i < kernels.size() && result.size() < maxCount; i++)
+                {
+                    // several close layers are often tuned to the same kernel
+                    if (std::find(result.begin(), result.end(), kernels[i].second) == result.end())
+                        result.push_back(kernels[i].second);
+                }
+                return result;
+            }
+
+        private:
+            const TuningDescriptor& descriptor;
+            size_t maxCount;
+            std::vector<std::pair<float, std::tuple<std::string, int>>> kernels;
+        };
+    }
+
+    AutoTuner::~AutoTuner()
+    {
+        try
+        {
+            FlushOnlineCache();
+        }
+        catch (...)
+        {
+            // destructors must not throw
+        }
+    }
+
+    AutoTuner::OnlineCache& AutoTuner::GetOnlineCache(const TuningMode tuningMode, const std::string& cacheFilePath)
+    {
+        auto it = onlineCaches.find(cacheFilePath);
+        if (it != onlineCaches.end())
+        {
+            return it->second;
+        }
+
+        auto& cache = onlineCaches[cacheFilePath];
         std::ifstream tuningFile(cacheFilePath);
         if (tuningFile && tuningFile.good())
         {
             rapidjson::IStreamWrapper isw{ tuningFile };
-            cacheData.ParseStream(isw);
+            cache.document.ParseStream(isw);
         }
         else // Tuning file doesn't exist
         {
             if (tuningMode == TuningMode::TUNING_USE_CACHE)
             {
+                onlineCaches.erase(cacheFilePath);
                 throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be read! Must provide a valid cache file in USE_CACHE mode.");
             }
 
             // Create a new tuning file and write the versions
             std::ofstream newTuningFile(cacheFilePath, std::ofstream::out);
-
         }
         tuningFile.close();
 
-        onlineCache = std::make_shared<rapidjson::Document>(std::move(cacheData));
+        if (cache.document.HasParseError() || !cache.document.IsObject())
+        {
+            cache.document.Parse("{}");
+        }
+
+        IndexOnlineCache(cache);
+        return cache;
+    }
 
-        // Tuning file is loaded
-        auto computeUnitsStr = std::to_string(computeUnitsCount);
-        if (!onlineCache->IsNull())
+    void AutoTuner::IndexOnlineCache(OnlineCache& cache)
+    {
+        cache.entries.clear();
+        cache.descriptors.clear();
+
+        // Index all device sections once, so lookups don't touch the document anymore.
+        for (auto section = cache.document.MemberBegin(); section != cache.document.MemberEnd(); ++section)
         {
-            auto cacheObject = onlineCache->GetObject();
-            if (onlineCache->HasMember(computeUnitsStr.c_str()))
+            if (!section->value.IsObject())
+                continue;
+
+            auto& entries = cache.entries[section->name.GetString()];
+            auto& descriptors = cache.descriptors[section->name.GetString()];
+            for (auto entry = section->value.MemberBegin(); entry != section->value.MemberEnd(); ++entry)
             {
-                if (cacheObject[computeUnitsStr.c_str()].HasMember(hash.c_str()))
+                const rapidjson::Value& prog = entry->value;
+                if (prog.IsArray() && prog.Size() >= 2 && prog[0].IsString() && prog[1].IsInt())
                 {
-                    const rapidjson::Value& prog = cacheObject[computeUnitsStr.c_str()][hash.c_str()];
-                    return std::make_tuple(prog[0].GetString(), prog[1].GetInt());
+                    entries[entry->name.GetString()] = std::make_tuple(prog[0].GetString(), prog[1].GetInt());
+
+                    TuningDescriptor descriptor;
+                    if (ReadDescriptor(prog, descriptor))
+                        descriptors[entry->name.GetString()] = std::move(descriptor);
                 }
             }
         }
-        return std::make_pair("", 0);
-        
+    }
+
+    std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode, const std::string& cacheFilePath, const uint32_t computeUnitsCount,  const std::string& hash)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& cache = GetOnlineCache(tuningMode, cacheFilePath);
+
+        auto section = cache.entries.find(std::to_string(computeUnitsCount));
+        if (section != cache.entries.end())
+        {
+            auto entry = section->second.find(hash);
+            if (entry != section->second.end())
+            {
+                return entry->second;
+            }
+        }
+        return std::make_tuple("", 0);
     }
 
     void AutoTuner::StoreKernel(const std::string& cacheFilePath, const std::string& hash, std::string implementationName, const int tuneIndex, const uint32_t computeUnitsCount)
+    {
+        StoreKernel(cacheFilePath, hash, implementationName, tuneIndex, computeUnitsCount, TuningStatistics(), TuningDescriptor());
+    }
+
+    void AutoTuner::StoreKernel(const std::string& cacheFilePath, const std::string& hash, std::string implementationName, const int tuneIndex, const uint32_t computeUnitsCount,
+                                const TuningStatistics& statistics, const TuningDescriptor& descriptor)
     {
         std::lock_guard<std::mutex> lock(mutex);
+        auto& cache = GetOnlineCache(TuningMode::TUNING_TUNE_AND_CACHE, cacheFilePath);
         auto computeUnitsStr = std::to_string(computeUnitsCount);
-        rapidjson::Document::AllocatorType& allocator = onlineCache->GetAllocator();
+        rapidjson::Document::AllocatorType& allocator = cache.document.GetAllocator();
         rapidjson::Value dataArray(rapidjson::kArrayType);
-        rapidjson::Value hashStr(rapidjson::kStringType);
-        hashStr.Set(hash.c_str(), allocator);
         dataArray.PushBack(rapidjson::Value().Set(implementationName.c_str(),allocator) , allocator);
         dataArray.PushBack(rapidjson::Value().SetInt(tuneIndex), allocator);
+        if (statistics.runs > 0 || !descriptor.Empty())
+        {
+            // exact lookups use only the first two elements, the distribution is kept for inspection of tuning results
+            // and the descriptor is used for lookups of layers which are not in the cache
+            rapidjson::Value info(rapidjson::kObjectType);
+            if (statistics.runs > 0)
+            {
+                info.AddMember("median_ns", rapidjson::Value().SetUint64(statistics.median), allocator);
+                info.AddMember("lower_bound_ns", rapidjson::Value().SetUint64(statistics.lowerBound), allocator);
+                info.AddMember("upper_bound_ns", rapidjson::Value().SetUint64(statistics.upperBound), allocator);
+                info.AddMember("runs", rapidjson::Value().SetUint64(statistics.runs), allocator);
+            }
+            if (!descriptor.Empty())
+            {
+                rapidjson::Value features(rapidjson::kArrayType);
+                for (auto feature : descriptor.features)
+                    features.PushBack(rapidjson::Value().SetDouble(feature), allocator);
+                rapidjson::Value descriptorValue(rapidjson::kObjectType);
+                descriptorValue.AddMember("kernel_type", rapidjson::Value().Set(descriptor.kernelType.c_str(), allocator), allocator);
+                descriptorValue.AddMember("features", features, allocator);
+                info.AddMember("descriptor", descriptorValue, allocator);
+            }
+            dataArray.PushBack(info, allocator);
+        }
+
+        if (!cache.document.HasMember(computeUnitsStr.c_str()))
+        {
+            cache.document.AddMember(rapidjson::Value(computeUnitsStr.c_str(), allocator), rapidjson::Value(rapidjson::kObjectType), allocator);
+        }
+
+        auto& section = cache.document[computeUnitsStr.c_str()];
+        if (section.HasMember(hash.c_str()))
+        {
+            section[hash.c_str()] = dataArray;
+        }
+        else
+        {
+            section.AddMember(rapidjson::Value(hash.c_str(), allocator), dataArray, allocator);
+        }
+
+        cache.entries[computeUnitsStr][hash] = std::make_tuple(implementationName, tuneIndex);
+        cache.updated[computeUnitsStr].insert(hash);
+        if (!descriptor.Empty())
+            cache.descriptors[computeUnitsStr][hash] = descriptor;
+        else
+            cache.descriptors[computeUnitsStr].erase(hash);
+        cache.dirty = true;
+    }
+
+    AutoTuner::CachedKernels AutoTuner::LoadNearestKernelsOnline(const TuningMode tuningMode, const std::string& cacheFilePath, const uint32_t computeUnitsCount,
+                                                                 const TuningDescriptor& descriptor, size_t maxCount)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& cache = GetOnlineCache(tuningMode, cacheFilePath);
+
+        NearestKernels nearest(descriptor, maxCount);
+        const auto computeUnitsStr = std::to_string(computeUnitsCount);
+        auto section = cache.descriptors.find(computeUnitsStr);
+        if (section != cache.descriptors.end())
+        {
+            const auto& entries = cache.entries[computeUnitsStr];
+            for (const auto& entry : section->second)
+            {
+                auto kernel = entries.find(entry.first);
+                if (kernel != entries.end())
+                    nearest.Add(entry.second, std::get<0>(kernel->second), std::get<1>(kernel->second));
+            }
+        }
+        return nearest.Get();
+    }
+
+    AutoTuner::CachedKernels AutoTuner::LoadNearestKernelsOffline(std::shared_ptr<rapidjson::Document> deviceCache, const TuningDescriptor& descriptor, size_t maxCount)
+    {
+        NearestKernels nearest(descriptor, maxCount);
+        if (deviceCache && deviceCache->IsObject())
+        {
+            TuningDescriptor other;
+            for (auto entry = deviceCache->MemberBegin(); entry != deviceCache->MemberEnd(); ++entry)
+            {
+                const rapidjson::Value& prog = entry->value;
+                if (prog.IsArray() && prog.Size() >= 3 && prog[0].IsString() && prog[1].IsInt() && ReadDescriptor(prog, other))
+                    nearest.Add(other, prog[0].GetString(), prog[1].GetInt());
+            }
+        }
+        return nearest.Get();
+    }
+
+    void AutoTuner::CountLookup(LookupResult result)
+    {
+        switch (result)
+        {
+        case LookupResult::EXACT_HIT:   exactHits++;    break;
+        case LookupResult::NEAREST_HIT: nearestHits++;  break;
+        case LookupResult::MISS:        misses++;       break;
+        }
+    }
+
+    AutoTuner::LookupStatistics AutoTuner::GetLookupStatistics() const
+    {
+        LookupStatistics statistics;
+        statistics.exactHits = exactHits;
+        statistics.nearestHits = nearestHits;
+        statistics.misses = misses;
+        return statistics;
+    }
+
+    void AutoTuner::FlushOnlineCache()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& cache : onlineCaches)
+        {
+            if (cache.second.dirty)
+            {
+                WriteOnlineCache(cache.first, cache.second);
+            }
+        }
+    }
+
+    void AutoTuner::StoreSamples(const std::string& cacheFilePath, const std::string& hash, const uint32_t computeUnitsCount, const std::vector<float>& features,
+                                 const std::vector<std::tuple<std::string, int, uint64_t>>& measurements)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::ofstream samplesFile(cacheFilePath + ".samples", std::ofstream::out | std::ofstream::app);
+        CostModel::WriteSamples(samplesFile, hash, computeUnitsCount, features, measurements);
+    }
 
-        rapidjson::Value newVal(rapidjson::kObjectType);
-        newVal.SetObject();
-        if (onlineCache->IsNull())
+    const CostModel* AutoTuner::LoadCostModel(const std::string& modelFilePath)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = costModels.find(modelFilePath);
+        if (it == costModels.end())
         {
-            onlineCache->Parse("{}");
+            std::unique_ptr<CostModel> model(new CostModel());
+            if (!model->Load(modelFilePath))
+                model.reset();
+            it = costModels.emplace(modelFilePath, std::move(model)).first;
+        }
+        return it->second.get();
+    }
+
+    void AutoTuner::WriteOnlineCache(const std::string& cacheFilePath, OnlineCache& cache)
+    {
+        // Other processes may have flushed their entries since the file was loaded, so only the entries stored by this
+        // process are applied over the current file content.
+        rapidjson::Document merged;
+        {
+            std::ifstream tuningFile(cacheFilePath);
+            if (tuningFile && tuningFile.good())
+            {
+                rapidjson::IStreamWrapper isw{ tuningFile };
+                merged.ParseStream(isw);
+            }
         }
-        if (!onlineCache->HasMember(computeUnitsStr.c_str()))
+        if (merged.HasParseError() || !merged.IsObject())
         {
-            onlineCache->AddMember(rapidjson::Value(computeUnitsStr.c_str(), allocator), newVal, allocator);
+            merged.Parse("{}");
         }
 
-        auto cache = onlineCache->GetObject();
-        cache[computeUnitsStr.c_str()].AddMember(hashStr, dataArray, allocator);
+        rapidjson::Document::AllocatorType& allocator = merged.GetAllocator();
+        for (const auto& updatedSection : cache.updated)
+        {
+            const auto& section = cache.document[updatedSection.first.c_str()];
+            if (!merged.HasMember(updatedSection.first.c_str()) || !merged[updatedSection.first.c_str()].IsObject())
+            {
+                merged.RemoveMember(updatedSection.first.c_str());
+                merged.AddMember(rapidjson::Value(updatedSection.first.c_str(), allocator), rapidjson::Value(rapidjson::kObjectType), allocator);
+            }
+
+            auto& mergedSection = merged[updatedSection.first.c_str()];
+            for (const auto& hash : updatedSection.second)
+            {
+                rapidjson::Value entry(section[hash.c_str()], allocator);
+                if (mergedSection.HasMember(hash.c_str()))
+                {
+                    mergedSection[hash.c_str()] = entry;
+                }
+                else
+                {
+                    mergedSection.AddMember(rapidjson::Value(hash.c_str(), allocator), entry, allocator);
+                }
+            }
+        }
 
-        std::ofstream cachedKernelsFile(cacheFilePath);
         rapidjson::StringBuffer buffer(0, 1024);
         rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
-        onlineCache->Accept(writer);
-        auto temp = buffer.GetString();
-        cachedKernelsFile << temp;
-        cachedKernelsFile.close();
+        merged.Accept(writer);
+
+        // Write the whole file aside and rename it, so concurrent readers never see a partially written cache.
+        // The temporary file is private to the process and thread, so concurrent writers don't replace each other's files.
+        std::stringstream tmpFileName;
+#ifdef _WIN32
+        tmpFileName << cacheFilePath << ".tmp" << _getpid() << "_" << std::this_thread::get_id();
+#else
+        tmpFileName << cacheFilePath << ".tmp" << getpid() << "_" << std::this_thread::get_id();
+#endif
+        const std::string tmpFilePath = tmpFileName.str();
+        {
+            std::ofstream cachedKernelsFile(tmpFilePath);
+            cachedKernelsFile << buffer.GetString();
+            if (!cachedKernelsFile.good())
+            {
+                throw std::runtime_error("Tuning file: " + tmpFilePath + " could not be written!");
+            }
+        }
+
+#ifdef _WIN32
+        std::remove(cacheFilePath.c_str()); // rename() does not replace existing files on Windows
+#endif
+        if (std::rename(tmpFilePath.c_str(), cacheFilePath.c_str()) != 0)
+        {
+            std::remove(tmpFilePath.c_str());
+            throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be written!");
+        }
+
+        // entries flushed by other processes become visible to this one
+        cache.document.Swap(merged);
+        IndexOnlineCache(cache);
+        cache.updated.clear();
+        cache.dirty = false;
     }
 
 
@@ -117,4 +436,15 @@ namespace kernel_selector
         }
         return std::make_tuple("", 0);
     }
+
+    std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const OfflineTuningCache& deviceCache, uint64_t hash)
+    {
+        const char* kernelName = nullptr;
+        int tuneIndex = 0;
+        if (deviceCache.Find(hash, kernelName, tuneIndex))
+        {
+            return std::make_tuple(kernelName, tuneIndex);
+        }
+        return std::make_tuple("", 0);
+    }
 }
@@ -19,7 +19,14 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
 #include "kernel_selector_common.h" 
+#include "offline_tuning_cache.h"
+#include "tuning_search.h"
+#include "cost_model.h"
+#include "tuning_descriptor.h"
 #include "document.h"
 
 
@@ -29,18 +36,73 @@ namespace kernel_selector
     class AutoTuner
     {
     public:
+        using CachedKernels = std::vector<std::tuple<std::string, int>>;
+
+        enum class LookupResult
+        {
+            EXACT_HIT,      // params hash found in the tuning cache
+            NEAREST_HIT,    // kernel of the closest compatible descriptor used
+            MISS,
+        };
+
+        struct LookupStatistics
+        {
+            uint64_t exactHits = 0;
+            uint64_t nearestHits = 0;
+            uint64_t misses = 0;
+        };
+
         AutoTuner() = default;
+        ~AutoTuner();
         std::tuple<std::string, int> LoadKernelOnline(const TuningMode tuningMode, const std::string& tuningFilePath, const uint32_t computeUnitsCount, const std::string& hash);
         void StoreKernel(const std::string& tuningFilePath, const std::string& hash, std::string implementationName, const int tuneIndex, const uint32_t computeUnitsCount);
+        // Stores the kernel together with its measured run time distribution and the descriptor of the tuned params.
+        void StoreKernel(const std::string& tuningFilePath, const std::string& hash, std::string implementationName, const int tuneIndex, const uint32_t computeUnitsCount,
+                         const TuningStatistics& statistics, const TuningDescriptor& descriptor);
+        // Kernels of up to maxCount entries with descriptors compatible with the given one, closest first.
+        CachedKernels LoadNearestKernelsOnline(const TuningMode tuningMode, const std::string& tuningFilePath, const uint32_t computeUnitsCount,
+                                               const TuningDescriptor& descriptor, size_t maxCount);
+        CachedKernels LoadNearestKernelsOffline(std::shared_ptr<rapidjson::Document> cache, const TuningDescriptor& descriptor, size_t maxCount);
         std::tuple<std::string, int> LoadKernelOffline(std::shared_ptr<rapidjson::Document> cache, const std::string& hash);
+        std::tuple<std::string, int> LoadKernelOffline(const OfflineTuningCache& cache, uint64_t hash);
+        // Writes all pending StoreKernel() updates to their tuning files.
+        void FlushOnlineCache();
+        // Appends run times of all measured candidates to "<tuning file>.samples", the training data of the cost model.
+        void StoreSamples(const std::string& tuningFilePath, const std::string& hash, const uint32_t computeUnitsCount, const std::vector<float>& features,
+                          const std::vector<std::tuple<std::string, int, uint64_t>>& measurements);
+        // Model is loaded once per file, nullptr if the file is not a valid model.
+        const CostModel* LoadCostModel(const std::string& modelFilePath);
+
+        void CountLookup(LookupResult result);
+        LookupStatistics GetLookupStatistics() const;
+
+    private:
+        using CacheEntries = std::unordered_map<std::string, std::tuple<std::string, int>>; // hash -> [implementation name, tuning index]
+
+        struct OnlineCache
+        {
+            rapidjson::Document document;                           // Whole tuning file content, written back on flush.
+            std::map<std::string, CacheEntries> entries;            // Compute units count -> index of the document section.
+            std::map<std::string, std::map<std::string, TuningDescriptor>> descriptors; // Compute units count -> hash -> descriptor of the entry.
+            std::map<std::string, std::set<std::string>> updated;   // Compute units count -> hashes stored since the last flush.
+            bool dirty = false;                                     // Document has updates not written to the file yet.
+        };
+
+        OnlineCache& GetOnlineCache(const TuningMode tuningMode, const std::string& tuningFilePath);
+        static void IndexOnlineCache(OnlineCache& cache);
+        void WriteOnlineCache(const std::string& tuningFilePath, OnlineCache& cache);
 
-    private:    
-        std::shared_ptr<rapidjson::Document> onlineCache; // Tuning file name -> kernel/config per hash (hash -> [implementation name, tuning index])
+        std::map<std::string, OnlineCache> onlineCaches; // Tuning file name -> cache loaded once from the file
+        std::map<std::string, std::unique_ptr<CostModel>> costModels; // Model file name -> model, nullptr if it could not be loaded
         std::mutex mutex; // Mutex to synchronize cache updates
+        std::atomic<uint64_t> exactHits{ 0 };
+        std::atomic<uint64_t> nearestHits{ 0 };
+        std::atomic<uint64_t> misses{ 0 };
         
         /*
             The offline cache contains for each hash (that is based on the node params) the best kernel/config per device id.
             This cache can be ignored by setting ENABLE_OFFLINE_TUNING_CACHE to 0 in kernel_selector.cpp (in this case the default path will be chosen).
+            At build time cache.json is converted into the memory-mapped binary cache.bin (see tuning_cache_gen.py), which is used instead of the json file when present.
             Follow these steps in order to change the data inside this cache:
             1. Find the proper device ID entry.
                For example: 0x193B for SKL GT4. 
@@ -57,6 +119,8 @@ namespace kernel_selector
                If there are more configs (for example for convolution_gpu_bfyx_os_iyx_osv16 kernel) you need to find the proper config index.
                For example, for the convolution_gpu_bfyx_os_iyx_osv16 kernel you need to take a look in the constructor (ConvolutionKernel_bfyx_os_iyx_osv16::ConvolutionKernel_bfyx_os_iyx_osv16) – 
                this is the index in the autoTuneOptions array.
+            Entries written by on-line tuning also carry the TuningDescriptor of the params. On an exact miss the kernel of the closest
+            compatible entry is used if it supports the params (json caches only, cache.bin has no descriptors).
         */
     };
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+// input   = data, its part starting at OFFSET is compared
+// compare = data compared with the input
+// output  = [1] 1 if COMPARE holds for all the compared elements, 0 otherwise
+__attribute__((reqd_work_group_size(LOCAL_SIZE, 1, 1)))
+KERNEL(condition_gpu_ref)(
+    const __global INPUT0_TYPE* input,
+    const __global INPUT1_TYPE* compare,
+    __global OUTPUT_TYPE* output)
+{
+    const uint lid = get_local_id(0);
+
+    __local int result;
+    if (lid == 0)
+        result = 1;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    int holds = 1;
+    for (uint i = lid; i < COMPARE_ELEMENTS; i += LOCAL_SIZE)
+    {
+        const uint x = i % INPUT1_SIZE_X;
+        const uint y = (i / INPUT1_SIZE_X) % INPUT1_SIZE_Y;
+        const uint f = (i / (INPUT1_SIZE_X * INPUT1_SIZE_Y)) % INPUT1_FEATURE_NUM;
+        const uint b = i / (INPUT1_SIZE_X * INPUT1_SIZE_Y * INPUT1_FEATURE_NUM);
+
+        const uint input_idx = GET_DATA_INDEX(INPUT0, b + OFFSET_BATCH_NUM, f + OFFSET_FEATURE_NUM, y + OFFSET_SIZE_Y, x + OFFSET_SIZE_X);
+        const uint compare_idx = GET_DATA_INDEX(INPUT1, b, f, y, x);
+        holds &= COMPARE(input[input_idx], compare[compare_idx]) ? 1 : 0;
+    }
+
+    if (!holds)
+        atomic_and(&result, 0);
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (lid == 0)
+        output[0] = (OUTPUT_TYPE)result;
+}
@@ -19,16 +19,18 @@
 #define DIRECTION 0
 #endif
 
-// input     = [    batch,  sequence,               1,      input_size ]
-// weights   = [        1, direction, 4 * hidden_size,      input_size ]
+// input     = [    batch,  sequence,               1,      input_size ] or [ batch, 1, 1, 4 * hidden_size ] if PROJECTED_INPUT
+// weights   = [        1, direction, 4 * hidden_size,      input_size ] not used if PROJECTED_INPUT
 // recurrent = [        1, direction, 4 * hidden_size,     hidden_size ]
 // biases    = [        1,         1,       direction, 4 * hidden_size ] optional
 // hidden    = [    batch, direction,               1,     hidden_size ] optional
 // tempGEMM  = [    batch, direction,               1, 4 * hidden_size ] output
 KERNEL(lstm_gemm)(
     const __global INPUT0_TYPE* input,
-    __global OUTPUT_TYPE* output,
-    const __global WEIGHTS_TYPE* weights
+    __global OUTPUT_TYPE* output
+#if !PROJECTED_INPUT
+    , const __global WEIGHTS_TYPE* weights
+#endif
 #if HIDDEN_TERM
     , const __global OUTPUT_TYPE* hidden,
     const __global RECURRENT_TYPE* recurrent
@@ -41,12 +43,16 @@ KERNEL(lstm_gemm)(
     const uint y = get_global_id(0);
     const uint b = get_global_id(1);
 
+#if PROJECTED_INPUT
+    ACCUMULATOR_TYPE dotProd = (ACCUMULATOR_TYPE)input[GET_DATA_INDEX(INPUT0, b, 0, 0, y)];
+#else
     ACCUMULATOR_TYPE dotProd = 0;
     for(uint x = 0; x < INPUT0_SIZE_X; ++x ) {
       const uint input_idx     = GET_DATA_INDEX(INPUT0, b, 0, INPUT_DIRECTION, x);
       const uint weights_idx   = GET_DATA_INDEX(WEIGHTS, 0, DIRECTION, y, x);
       dotProd += (ACCUMULATOR_TYPE)(input[input_idx] * weights[weights_idx]);
     }
+#endif
 
 #if HIDDEN_TERM
     for(uint x = 0; x < HIDDEN_SIZE_X; ++x ) {
@@ -34,8 +34,8 @@
     val += (SIMD > 16) ? intel_sub_group_shuffle(val, x+16) : 0; \ 
 } 
 
-// input     = [    batch,  sequence,               1,      input_size ]
-// weights   = [        1, direction, 4 * hidden_size,      input_size ]
+// input     = [    batch,  sequence,               1,      input_size ] or [ batch, 1, 1, 4 * hidden_size ] if PROJECTED_INPUT
+// weights   = [        1, direction, 4 * hidden_size,      input_size ] not used if PROJECTED_INPUT
 // recurrent = [        1, direction, 4 * hidden_size,     hidden_size ]
 // biases    = [        1,         1,       direction, 4 * hidden_size ] optional
 // hidden    = [    batch, direction,               1,     hidden_size ] optional
@@ -44,8 +44,10 @@
 __attribute__((reqd_work_group_size(SIMD, 1, 1)))
 KERNEL(lstm_gemm)(
     const __global INPUT0_TYPE* input,
-    __global OUTPUT_TYPE* output,
-    const __global WEIGHTS_TYPE* weights
+    __global OUTPUT_TYPE* output
+#if !PROJECTED_INPUT
+    , const __global WEIGHTS_TYPE* weights
+#endif
 #if HIDDEN_TERM
     , const __global OUTPUT_TYPE* hidden,
     const __global RECURRENT_TYPE* recurrent
@@ -68,6 +70,9 @@ KERNEL(lstm_gemm)(
 	float4 sum;
 	float result;
 	
+#if PROJECTED_INPUT
+	result = 0;
+#else
 	K = INPUT0_SIZE_X;  // Width of  weight matrix
 	start_offset = GET_DATA_INDEX(WEIGHTS, 0, DIRECTION, y, 0);  // set as the starting offset of the weight matrix 
 	end_offset = start_offset + K;
@@ -87,6 +92,7 @@ KERNEL(lstm_gemm)(
 	}
 	
 	result = sum.x + sum.y + sum.z + sum.w;
+#endif
 
 #if HIDDEN_TERM
 	K = HIDDEN_SIZE_X;  // width of recurrent matrix
@@ -114,6 +120,9 @@ KERNEL(lstm_gemm)(
 
 	if(x == 0) 
 	{	
+#if PROJECTED_INPUT
+		result += (float)input[GET_DATA_INDEX(INPUT0, 0, 0, 0, y)];
+#endif
 		output[y] = (OUTPUT_TYPE)result;
 
 #if BIAS_TERM
@@ -33,8 +33,8 @@
     val += intel_sub_group_shuffle(val, x+8); \
 } 
 
-// input     = [    batch,  sequence,               1,      input_size ]
-// weights   = [        1, direction, 4 * hidden_size,      input_size ]
+// input     = [    batch,  sequence,               1,      input_size ] or [ batch, 1, 1, 4 * hidden_size ] if PROJECTED_INPUT
+// weights   = [        1, direction, 4 * hidden_size,      input_size ] not used if PROJECTED_INPUT
 // recurrent = [        1, direction, 4 * hidden_size,     hidden_size ]
 // biases    = [        1,         1,       direction, 4 * hidden_size ] optional
 // hidden    = [    batch, direction,               1,     hidden_size ] optional
@@ -43,8 +43,10 @@
 __attribute__((reqd_work_group_size(SIMD, 1, 1)))
 KERNEL(lstm_gemm)(
     const __global INPUT0_TYPE* input,
-    __global OUTPUT_TYPE* output,
-    const __global WEIGHTS_TYPE* weights
+    __global OUTPUT_TYPE* output
+#if !PROJECTED_INPUT
+    , const __global WEIGHTS_TYPE* weights
+#endif
 #if HIDDEN_TERM
     , const __global OUTPUT_TYPE* hidden,
     const __global RECURRENT_TYPE* recurrent
@@ -66,6 +68,9 @@ KERNEL(lstm_gemm)(
 	float4 sum;
 	float result;
 	
+#if PROJECTED_INPUT
+	result = 0;
+#else
 	K = INPUT0_SIZE_X;  // Width of  weight matrix
 	start_offset = GET_DATA_INDEX(WEIGHTS, 0, DIRECTION, y, 0);  // set as the starting offset of the weight matrix 
 	end_offset = start_offset + K;
@@ -85,6 +90,7 @@ KERNEL(lstm_gemm)(
 	}
 	
 	result = sum.x + sum.y + sum.z + sum.w;
+#endif
 
 #if HIDDEN_TERM
 	K = HIDDEN_SIZE_X;  // width of recurrent matrix
@@ -114,6 +120,10 @@ KERNEL(lstm_gemm)(
 	{	
 	    output[y] = 0;// (half)result;
 
+#if PROJECTED_INPUT
+		result += (float)input[GET_DATA_INDEX(INPUT0, 0, 0, 0, y)];
+#endif
+
 #if BIAS_TERM
 		const uint bias_idx = GET_DATA_INDEX(BIAS, 0, 0, DIRECTION, y);
 		half bias = biases[bias_idx];
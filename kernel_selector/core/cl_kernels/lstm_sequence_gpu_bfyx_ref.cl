@@ -0,0 +1,136 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+#define ACTIVATION_LOGISTIC(input)                      (UNIT_VAL_ONE/(UNIT_VAL_ONE + exp(-input)))
+#define ACTIVATION_HYPERBOLIC_TAN(input)                (tanh(input))
+
+// input     = [    batch,  sequence, input_direction,      input_size ] or [ batch, sequence, direction, 4 * hidden_size ] if PROJECTED_INPUT
+// weights   = [        1, direction, 4 * hidden_size,      input_size ] not used if PROJECTED_INPUT
+// recurrent = [        1, direction, 4 * hidden_size,     hidden_size ]
+// biases    = [        1,         1,       direction, 4 * hidden_size ] optional
+// hidden    = [    batch,         1,       direction,     hidden_size ] optional initial hidden state
+// cell      = [    batch,         1,       direction,     hidden_size ] optional initial cell state
+// output    = [    batch,   outputs,       direction,     hidden_size ] hidden of each step or of the last one, then the last cell
+//
+// A work group runs all the steps of one batch and direction. The gates and the hidden state of the current step are
+// shared by the work items through local memory, each work item keeps its part of the cell state in registers.
+__attribute__((reqd_work_group_size(LOCAL_SIZE, 1, 1)))
+KERNEL(lstm_sequence)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+#if !PROJECTED_INPUT
+    const __global WEIGHTS_TYPE* weights,
+#endif
+    const __global RECURRENT_TYPE* recurrent
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+#if INITIAL_HIDDEN_TERM
+    , const __global INITIAL_HIDDEN_TYPE* initial_hidden
+#endif
+#if INITIAL_CELL_TERM
+    , const __global INITIAL_CELL_TYPE* initial_cell
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint b = get_global_id(1);
+    const uint dir = get_global_id(2);
+
+    __local ACCUMULATOR_TYPE gates[GATES_SIZE];
+    __local ACCUMULATOR_TYPE hidden[STATE_SIZE];
+    ACCUMULATOR_TYPE cell[CELLS_PER_ITEM];
+
+    for (uint k = 0; k < CELLS_PER_ITEM; ++k) {
+        const uint x = lid + k * LOCAL_SIZE;
+        if (x < STATE_SIZE) {
+#if INITIAL_HIDDEN_TERM
+            hidden[x] = (ACCUMULATOR_TYPE)initial_hidden[GET_DATA_INDEX(INITIAL_HIDDEN, b, 0, INITIAL_HIDDEN_SIZE_Y > 1 ? dir : 0, x)];
+#else
+            hidden[x] = 0;
+#endif
+#if INITIAL_CELL_TERM
+            cell[k] = (ACCUMULATOR_TYPE)initial_cell[GET_DATA_INDEX(INITIAL_CELL, b, 0, INITIAL_CELL_SIZE_Y > 1 ? dir : 0, x)];
+#else
+            cell[k] = 0;
+#endif
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // the backward direction of a unidirectional input reads the sequence in reverse,
+    // a bidirectional input has a separate sequence per direction, and so does the projection of any input
+    const uint input_direction = INPUT0_SIZE_Y > 1 ? dir : 0;
+    const bool reverse = INPUT_DIRECTIONS < 2 && dir > 0;
+
+    for (uint t = 0; t < SEQUENCE_LENGTH; ++t) {
+        const uint input_t = reverse ? SEQUENCE_LENGTH - t - 1 : t;
+
+        for (uint y = lid; y < GATES_SIZE; y += LOCAL_SIZE) {
+#if PROJECTED_INPUT
+            ACCUMULATOR_TYPE dotProd = (ACCUMULATOR_TYPE)input[GET_DATA_INDEX(INPUT0, b, input_t, input_direction, y)];
+#else
+            ACCUMULATOR_TYPE dotProd = 0;
+            for (uint x = 0; x < INPUT0_SIZE_X; ++x) {
+                const uint input_idx   = GET_DATA_INDEX(INPUT0, b, input_t, input_direction, x);
+                const uint weights_idx = GET_DATA_INDEX(WEIGHTS, 0, dir, y, x);
+                dotProd += (ACCUMULATOR_TYPE)(input[input_idx] * weights[weights_idx]);
+            }
+#endif
+            for (uint x = 0; x < STATE_SIZE; ++x) {
+                dotProd += hidden[x] * (ACCUMULATOR_TYPE)recurrent[GET_DATA_INDEX(RECURRENT, 0, dir, y, x)];
+            }
+#if BIAS_TERM
+            dotProd += (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, dir, y)];
+#endif
+            gates[y] = dotProd;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint k = 0; k < CELLS_PER_ITEM; ++k) {
+            const uint x = lid + k * LOCAL_SIZE;
+            if (x < STATE_SIZE) {
+                ACCUMULATOR_TYPE it = gates[x + GEMM_OFFSET_I];
+                ACCUMULATOR_TYPE ot = gates[x + GEMM_OFFSET_O];
+                ACCUMULATOR_TYPE zt = gates[x + GEMM_OFFSET_Z];
+                ACCUMULATOR_TYPE ft = gates[x + GEMM_OFFSET_F];
+
+                ACCUMULATOR_TYPE val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
+#if INPUT_FORGET
+                val *= ((ACCUMULATOR_TYPE)1 - ft);
+#endif
+                val += cell[k] * ACTIVATION_LOGISTIC(CLIP(ft));
+                const ACCUMULATOR_TYPE h = ACTIVATION_HYPERBOLIC_TAN(val) * ACTIVATION_LOGISTIC(ot);
+
+                cell[k] = val;
+                hidden[x] = h;
+
+#if EMIT_SEQUENCE
+                output[GET_DATA_INDEX(OUTPUT, b, t, dir, x)] = (OUTPUT_TYPE)h;
+#else
+                if (t == SEQUENCE_LENGTH - 1)
+                    output[GET_DATA_INDEX(OUTPUT, b, 0, dir, x)] = (OUTPUT_TYPE)h;
+#endif
+#if EMIT_LAST_CELL
+                if (t == SEQUENCE_LENGTH - 1)
+                    output[GET_DATA_INDEX(OUTPUT, b, OUTPUT_FEATURE_NUM - 1, dir, x)] = (OUTPUT_TYPE)val;
+#endif
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
@@ -0,0 +1,169 @@
+#!/usr/bin/python
+
+# Trains the cost model which is used by the cost model tuning mode (kernel_selector::CostModel) from the samples
+# written next to the tuning cache by on-line tuning (<cache file>.samples).
+#
+# Every candidate (kernel name, tune index) gets a ridge regression of log2 of its median run time over the
+# features of the params. Quality is reported on a k-fold split by layer: top-1 agreement with the fastest
+# measured candidate and the mean slowdown of the predicted candidate. If the tuning cache (cache.json) is given,
+# agreement with the kernels selected by tuning is reported as well.
+#
+# Samples line: <params hash> <compute units> <kernel name> <tune index> <median ns> <feature 0> ... <feature n-1>
+# Model file:   "CLDNN_COST_MODEL <version> <features count>", then per candidate:
+#               <kernel name> <tune index> <training samples> <weight 0> ... <weight n-1>
+
+from __future__ import print_function
+import os
+import argparse
+import json
+import math
+
+MAGIC = 'CLDNN_COST_MODEL'
+VERSION = 1
+MIN_SAMPLES = 3
+
+
+def solve(a, b):
+    # gaussian elimination with partial pivoting, a is symmetric positive definite thanks to the ridge term
+    n = len(b)
+    m = [row[:] + [b[i]] for i, row in enumerate(a)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(m[r][col]))
+        m[col], m[pivot] = m[pivot], m[col]
+        for r in range(col + 1, n):
+            factor = m[r][col] / m[col][col]
+            if factor:
+                for c in range(col, n + 1):
+                    m[r][c] -= factor * m[col][c]
+    x = [0.0] * n
+    for r in reversed(range(n)):
+        x[r] = (m[r][n] - sum(m[r][c] * x[c] for c in range(r + 1, n))) / m[r][r]
+    return x
+
+
+def ridge(rows, targets, penalty):
+    n = len(rows[0])
+    a = [[0.0] * n for _ in range(n)]
+    b = [0.0] * n
+    for row, target in zip(rows, targets):
+        for i in range(n):
+            if row[i] == 0.0:
+                continue
+            b[i] += row[i] * target
+            for j in range(n):
+                a[i][j] += row[i] * row[j]
+    # the bias (feature 0) is not penalized
+    for i in range(1, n):
+        a[i][i] += penalty
+    a[0][0] += 1e-6
+    return solve(a, b)
+
+
+def predict(weights, features):
+    return sum(w * f for w, f in zip(weights, features))
+
+
+class CostModelTrainer(object):
+
+    def __init__(self, samples_files, penalty):
+        self.penalty = penalty
+        self.layers = {}    # (compute units, hash) -> (features, {(kernel name, tune index): median ns})
+        for samples_file in samples_files:
+            print('processing {}'.format(os.path.abspath(samples_file)))
+            with open(samples_file) as f:
+                for line in f:
+                    fields = line.split()
+                    if len(fields) < 6:
+                        continue
+                    key = (fields[1], fields[0])
+                    features = [float(v) for v in fields[5:]]
+                    layer = self.layers.setdefault(key, (features, {}))
+                    # the last measurement of a candidate wins if a layer was tuned several times
+                    layer[1][(fields[2], int(fields[3]))] = float(fields[4])
+        counts = set(len(features) for features, _ in self.layers.values())
+        if len(counts) > 1:
+            raise ValueError('samples have different features counts: {}'.format(sorted(counts)))
+        self.features_count = counts.pop() if counts else 0
+
+    def train(self, layer_keys):
+        data = {}
+        for key in layer_keys:
+            features, measurements = self.layers[key]
+            for candidate, median in measurements.items():
+                data.setdefault(candidate, ([], []))
+                data[candidate][0].append(features)
+                data[candidate][1].append(math.log(max(median, 1.0), 2))
+        return dict((candidate, (ridge(rows, targets, self.penalty), len(rows)))
+                    for candidate, (rows, targets) in data.items())
+
+    @staticmethod
+    def rank(models, features, candidates):
+        known = [c for c in candidates if c in models and models[c][1] >= MIN_SAMPLES]
+        if not known:
+            return None
+        return min(known, key=lambda c: predict(models[c][0], features))
+
+    def validate(self, folds):
+        keys = sorted(self.layers.keys())
+        if len(keys) < folds or folds < 2:
+            print('not enough layers for {}-fold validation'.format(folds))
+            return
+        hits, covered, slowdown = 0, 0, 0.0
+        for fold in range(folds):
+            test = keys[fold::folds]
+            test_set = set(test)
+            models = self.train([k for k in keys if k not in test_set])
+            for key in test:
+                features, measurements = self.layers[key]
+                predicted = self.rank(models, features, measurements.keys())
+                if predicted is None:
+                    continue
+                best = min(measurements, key=measurements.get)
+                covered += 1
+                hits += predicted == best
+                slowdown += measurements[predicted] / measurements[best]
+        if covered:
+            print('{}-fold validation: {} of {} layers predicted, top-1 agreement {:.1f}%, mean slowdown {:.3f}x'.format(
+                folds, covered, len(keys), 100.0 * hits / covered, slowdown / covered))
+
+    def validate_cache(self, models, cache_file):
+        with open(cache_file) as f:
+            cache = json.load(f)
+        hits, covered = 0, 0
+        for (compute_units, hash_str), (features, measurements) in self.layers.items():
+            entry = cache.get(compute_units, {}).get(hash_str)
+            if not entry:
+                continue
+            predicted = self.rank(models, features, measurements.keys())
+            if predicted is None:
+                continue
+            covered += 1
+            hits += predicted == (entry[0], int(entry[1]))
+        print('agreement with {}: {} of {} cached layers'.format(os.path.abspath(cache_file), hits, covered))
+
+    def write(self, models, out_file):
+        with open(out_file, 'w') as f:
+            f.write('{} {} {}\n'.format(MAGIC, VERSION, self.features_count))
+            for (kernel_name, tune_index), (weights, samples) in sorted(models.items()):
+                f.write('{} {} {} {}\n'.format(kernel_name, tune_index, samples, ' '.join(repr(w) for w in weights)))
+        print('{} candidates written to {}'.format(len(models), os.path.abspath(out_file)))
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('-samples', required=True, nargs='+', metavar='PATH', help='Samples files written by on-line tuning')
+    ap.add_argument('-out', required=True, metavar='PATH', help='Output cost model file')
+    ap.add_argument('-cache', metavar='PATH', help='Tuning cache json file used for validation')
+    ap.add_argument('-ridge', type=float, default=0.1, help='L2 penalty of the weights')
+    ap.add_argument('-folds', type=int, default=5, help='Number of cross-validation folds, split by layer')
+    args = ap.parse_args()
+
+    trainer = CostModelTrainer(args.samples, args.ridge)
+    trainer.validate(args.folds)
+    models = trainer.train(trainer.layers.keys())
+    if args.cache:
+        trainer.validate_cache(models, args.cache)
+    trainer.write(models, args.out)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,101 @@
+#!/usr/bin/python
+
+# Converts the off-line tuning cache (cache.json) into the compact binary format
+# which is memory-mapped by kernel_selector::OfflineTuningCache at engine creation.
+#
+# Layout (little-endian, see offline_tuning_cache.h):
+#   header:   char[8] magic, uint32 version, uint32 sections count, uint32 names count, uint32 names table offset
+#   sections: per compute units section: uint32 compute units, uint32 entries count, uint64 entries offset
+#   entries:  per section, sorted by hash: uint64 hash, uint32 kernel name index, int32 tune index
+#   names:    per kernel name: uint32 offset, uint32 length; followed by null-terminated names
+
+from __future__ import print_function
+import os
+import argparse
+import json
+import struct
+
+MAGIC = b'CLDNNTC\0'
+VERSION = 1
+
+HEADER_FMT = '<8sIIII'
+SECTION_FMT = '<IIQ'
+ENTRY_FMT = '<QIi'
+NAME_FMT = '<II'
+
+
+def align(offset, alignment=8):
+    return (offset + alignment - 1) // alignment * alignment
+
+
+def first_of_duplicates(pairs):
+    # cache.json has hashes repeated within a section, the json lookup (rapidjson FindMember) finds the first one
+    result = {}
+    for key, value in pairs:
+        result.setdefault(key, value)
+    return result
+
+
+class TuningCacheConverter(object):
+
+    def __init__(self, cache_file, out_path, out_file_name):
+        self.cache_file = os.path.abspath(cache_file)
+        self.out_path = os.path.abspath(out_path)
+        self.out_file_name = out_file_name
+
+    def convert(self):
+        print('processing {}'.format(self.cache_file))
+        with open(self.cache_file) as f:
+            cache = json.load(f, object_pairs_hook=first_of_duplicates)
+
+        names = sorted(set(prog[0] for section in cache.values() for prog in section.values()))
+        name_indices = dict((name, idx) for idx, name in enumerate(names))
+        sections = []
+        for compute_units in sorted(cache.keys(), key=int):
+            entries = []
+            # entries written by on-line tuning may have the measured run times appended
+            for hash_str, prog in cache[compute_units].items():
+                kernel_name, tune_index = prog[0], prog[1]
+                entries.append((int(hash_str), name_indices[kernel_name], int(tune_index)))
+            entries.sort()
+            sections.append((int(compute_units), entries))
+
+        # header and sections table are filled in once all offsets are known
+        data = bytearray(struct.calcsize(HEADER_FMT) + len(sections) * struct.calcsize(SECTION_FMT))
+        section_table = b''
+        for compute_units, entries in sections:
+            data += b'\0' * (align(len(data)) - len(data))
+            section_table += struct.pack(SECTION_FMT, compute_units, len(entries), len(data))
+            for entry in entries:
+                data += struct.pack(ENTRY_FMT, *entry)
+
+        data += b'\0' * (align(len(data)) - len(data))
+        names_offset = len(data)
+        strings_offset = names_offset + len(names) * struct.calcsize(NAME_FMT)
+        strings_data = b''
+        for name in names:
+            encoded = name.encode('ascii')
+            data += struct.pack(NAME_FMT, strings_offset + len(strings_data), len(encoded))
+            strings_data += encoded + b'\0'
+        data += strings_data
+
+        header = struct.pack(HEADER_FMT, MAGIC, VERSION, len(sections), len(names), names_offset)
+        data[0:len(header) + len(section_table)] = header + section_table
+
+        out_file_name = os.path.join(self.out_path, self.out_file_name)
+        with open(out_file_name, 'wb') as out_file:
+            out_file.write(data)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('-cache', required=True, metavar='PATH', help='The absolute path to the tuning cache json file')
+    ap.add_argument('-out_path', required=True, metavar='PATH', help='The absolute path to dump file')
+    ap.add_argument('-out_file_name', required=True, metavar='PATH', help='dump file name')
+    args = ap.parse_args()
+
+    converter = TuningCacheConverter(args.cache, args.out_path, args.out_file_name)
+    converter.convert()
+
+if __name__ == '__main__':
+    main()
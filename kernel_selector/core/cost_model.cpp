@@ -0,0 +1,148 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "cost_model.h"
+#include "kernel_selector_params.h"
+#include "convolution/convolution_params.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace kernel_selector
+{
+    constexpr uint32_t CostModel::version;
+    constexpr uint32_t CostModel::minSamples;
+
+    namespace
+    {
+        float LogSize(size_t value)
+        {
+            return std::log2(1.f + static_cast<float>(value));
+        }
+    }
+
+    std::vector<float> CostModel::GetFeatures(const Params& params)
+    {
+        std::vector<float> features(FEATURES_COUNT, 0.f);
+        features[BIAS] = 1.f;
+        features[COMPUTE_UNITS] = LogSize(params.engineInfo.computeUnitsCount);
+
+        const auto* baseParams = dynamic_cast<const base_params*>(&params);
+        if (!baseParams)
+            return features;
+
+        const auto& output = baseParams->output;
+        features[OUTPUT_B] = LogSize(output.Batch().v);
+        features[OUTPUT_F] = LogSize(output.Feature().v);
+        features[OUTPUT_Y] = LogSize(output.Y().v);
+        features[OUTPUT_X] = LogSize(output.X().v);
+
+        if (!baseParams->inputs.empty())
+        {
+            const auto& input = baseParams->inputs[0];
+            features[INPUT_B] = LogSize(input.Batch().v);
+            features[INPUT_F] = LogSize(input.Feature().v);
+            features[INPUT_Y] = LogSize(input.Y().v);
+            features[INPUT_X] = LogSize(input.X().v);
+            features[DATA_TYPE_F16] = input.GetDType() == Datatype::F16 ? 1.f : 0.f;
+            features[DATA_TYPE_INT8] = input.GetDType() == Datatype::INT8 || input.GetDType() == Datatype::UINT8 ? 1.f : 0.f;
+            features[LAYOUT_BFYX] = input.GetLayout() == DataLayout::bfyx ? 1.f : 0.f;
+            features[LAYOUT_YXFB] = input.GetLayout() == DataLayout::yxfb ? 1.f : 0.f;
+            features[LAYOUT_OTHER] = 1.f - features[LAYOUT_BFYX] - features[LAYOUT_YXFB];
+        }
+
+        if (params.GetType() == KernelType::CONVOLUTION)
+        {
+            const auto& convParams = static_cast<const convolution_params&>(params);
+            features[FILTER_X] = LogSize(convParams.filterSize.x);
+            features[FILTER_Y] = LogSize(convParams.filterSize.y);
+            features[STRIDE_X] = LogSize(convParams.stride.x);
+            features[STRIDE_Y] = LogSize(convParams.stride.y);
+            features[DILATION] = LogSize(std::max(convParams.dilation.x, convParams.dilation.y));
+            features[GROUPS] = LogSize(std::max(convParams.split, convParams.groups));
+            features[DEPTHWISE] = convParams.depthwise_separable_opt ? 1.f : 0.f;
+        }
+
+        return features;
+    }
+
+    void CostModel::WriteSamples(std::ostream& stream, const std::string& hash, uint32_t computeUnitsCount, const std::vector<float>& features,
+                                 const std::vector<std::tuple<std::string, int, uint64_t>>& measurements)
+    {
+        std::stringstream featuresStr;
+        for (auto feature : features)
+            featuresStr << " " << feature;
+
+        for (const auto& measurement : measurements)
+        {
+            stream << hash << " " << computeUnitsCount << " " << std::get<0>(measurement) << " " << std::get<1>(measurement) << " "
+                   << std::get<2>(measurement) << featuresStr.str() << "\n";
+        }
+    }
+
+    bool CostModel::Load(const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string magic;
+        uint32_t fileVersion = 0;
+        uint32_t featuresCount = 0;
+        if (!(file >> magic >> fileVersion >> featuresCount) ||
+            magic != "CLDNN_COST_MODEL" || fileVersion != version || featuresCount != FEATURES_COUNT)
+            return false;
+
+        std::map<std::string, std::vector<Weights>> loaded;
+        std::string kernelName;
+        while (file >> kernelName)
+        {
+            Weights model;
+            uint32_t samples = 0;
+            model.weights.resize(FEATURES_COUNT);
+            if (!(file >> model.tuneIndex >> samples))
+                return false;
+            for (auto& weight : model.weights)
+            {
+                if (!(file >> weight))
+                    return false;
+            }
+            if (samples >= minSamples)
+                loaded[kernelName].push_back(std::move(model));
+        }
+
+        models = std::move(loaded);
+        return true;
+    }
+
+    std::vector<CostModel::Candidate> CostModel::Rank(const std::string& kernelName, const std::vector<float>& features) const
+    {
+        std::vector<Candidate> candidates;
+        auto it = models.find(kernelName);
+        if (it == models.end() || features.size() != FEATURES_COUNT)
+            return candidates;
+
+        for (const auto& model : it->second)
+        {
+            float prediction = 0.f;
+            for (size_t i = 0; i < features.size(); i++)
+                prediction += model.weights[i] * features[i];
+            candidates.push_back({ kernelName, model.tuneIndex, prediction });
+        }
+
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [](const Candidate& a, const Candidate& b) { return a.predictedTime < b.predictedTime; });
+        return candidates;
+    }
+}
@@ -0,0 +1,87 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "kernel_selector_common.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CostModel
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Predicts run time of tuning candidates (kernel name and tune index) from features of the params, so a kernel
+    // close to the tuned one can be chosen for layers which were never tuned. Each candidate has a linear model of
+    // log2 of its run time in nano-seconds. The model file is trained by cost_model_gen.py from the samples which are
+    // written next to the tuning cache by on-line tuning.
+    //
+    // Model file (text): "CLDNN_COST_MODEL <version> <features count>", then one line per candidate:
+    // "<kernel name> <tune index> <training samples> <weight 0> ... <weight n-1>".
+    // Samples file (text): one line per measured candidate:
+    // "<params hash> <compute units> <kernel name> <tune index> <median ns> <feature 0> ... <feature n-1>".
+    class CostModel
+    {
+    public:
+        static constexpr uint32_t version = 1;
+
+        enum Feature
+        {
+            BIAS,
+            OUTPUT_B, OUTPUT_F, OUTPUT_Y, OUTPUT_X,
+            INPUT_B, INPUT_F, INPUT_Y, INPUT_X,
+            DATA_TYPE_F16, DATA_TYPE_INT8,
+            LAYOUT_BFYX, LAYOUT_YXFB, LAYOUT_OTHER,
+            COMPUTE_UNITS,
+            FILTER_X, FILTER_Y, STRIDE_X, STRIDE_Y, DILATION, GROUPS, DEPTHWISE,
+            FEATURES_COUNT
+        };
+
+        struct Candidate
+        {
+            std::string kernelName;
+            int tuneIndex;
+            float predictedTime;    // log2 of nano-seconds
+        };
+
+        // Sizes are log2(1 + value), flags are 0 or 1.
+        static std::vector<float> GetFeatures(const Params& params);
+        static void WriteSamples(std::ostream& stream, const std::string& hash, uint32_t computeUnitsCount, const std::vector<float>& features,
+                                 const std::vector<std::tuple<std::string, int, uint64_t>>& measurements);
+
+        // Returns false if the file doesn't exist or is not a valid model.
+        bool Load(const std::string& path);
+
+        // Candidates of the kernel known to the model with enough training samples, fastest first.
+        std::vector<Candidate> Rank(const std::string& kernelName, const std::vector<float>& features) const;
+
+    private:
+        struct Weights
+        {
+            int tuneIndex;
+            std::vector<float> weights;
+        };
+
+        static constexpr uint32_t minSamples = 3;
+
+        std::map<std::string, std::vector<Weights>> models; // kernel name -> models of its tune indices
+    };
+}
@@ -41,6 +41,12 @@ namespace kernel_selector
         {
             return GetKernelsData(params, options);
         }
+        // Estimated time of the kernel GetKernelsData would return, computed without generating its source.
+        // NOT_SUPPORTED if the params can't be handled, PRIORITY_NOT_ESTIMATED if the kernel has to be generated to know it.
+        virtual float GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const
+        {
+            return PRIORITY_NOT_ESTIMATED;
+        }
 
         virtual ParamsKey GetSupportedKey() const = 0;
         virtual const std::string GetName() const { return kernelName; }
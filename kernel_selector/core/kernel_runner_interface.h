@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "kernel_selector_common.h"
+
 namespace kernel_selector 
 {
     class KernelRunnerInterface
@@ -24,6 +29,27 @@ namespace kernel_selector
         // Gets a list of kernels, executes them and returns the run time of each kernel (in nano-seconds).
         virtual std::vector<uint64_t> run_kernels(const kernel_selector::KernelsData& kernelsData) = 0;
 
+        // Executes each kernel warmupRuns times without measuring it, then timedRuns times and returns the run times
+        // of all the measured runs of each kernel (in nano-seconds). Failed runs are left out, so a kernel which could
+        // not be run gets no samples.
+        virtual std::vector<std::vector<uint64_t>> run_kernels_samples(const kernel_selector::KernelsData& kernelsData, int warmupRuns, int timedRuns)
+        {
+            for (int i = 0; i < warmupRuns; i++)
+                run_kernels(kernelsData);
+
+            std::vector<std::vector<uint64_t>> samples(kernelsData.size());
+            for (int i = 0; i < timedRuns; i++)
+            {
+                auto runTimes = run_kernels(kernelsData);
+                for (size_t k = 0; k < samples.size() && k < runTimes.size(); k++)
+                {
+                    if (runTimes[k] != std::numeric_limits<uint64_t>::max())
+                        samples[k].push_back(runTimes[k]);
+                }
+            }
+            return samples;
+        }
+
         virtual ~KernelRunnerInterface() = default;
     };
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "kernel_selection_cache.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace kernel_selector
+{
+    namespace
+    {
+        const char cacheMagic[8] = { 'C', 'L', 'D', 'N', 'N', 'K', 'S', '\0' };
+        const uint32_t cacheVersion = 1;
+
+        template <typename T>
+        void Write(std::ostream& stream, const T& value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void WriteString(std::ostream& stream, const std::string& value)
+        {
+            Write(stream, static_cast<uint32_t>(value.size()));
+            stream.write(value.data(), value.size());
+        }
+
+        template <typename T>
+        bool Read(std::istream& stream, T& value)
+        {
+            stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+            return stream.good();
+        }
+
+        bool ReadString(std::istream& stream, std::string& value)
+        {
+            uint32_t size = 0;
+            if (!Read(stream, size))
+                return false;
+            value.resize(size);
+            stream.read(&value[0], size);
+            return stream.gcount() == static_cast<std::streamsize>(size);
+        }
+    }
+
+    // Layout: char[8] magic, uint32 version, string key, uint32 entries count,
+    // entries: uint64 hash, int32 tune index, string kernel name (strings are uint32 length followed by characters)
+    bool KernelSelectionCache::Import(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.good())
+            return false;
+
+        char magic[sizeof(cacheMagic)];
+        uint32_t version = 0;
+        std::string fileKey;
+        uint32_t count = 0;
+        file.read(magic, sizeof(magic));
+        if (!file.good() ||
+            !std::equal(std::begin(magic), std::end(magic), std::begin(cacheMagic)) ||
+            !Read(file, version) || version != cacheVersion ||
+            !ReadString(file, fileKey) || fileKey != key ||
+            !Read(file, count))
+            return false;
+
+        std::unordered_map<uint64_t, std::tuple<std::string, int>> imported;
+        imported.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint64_t hash = 0;
+            int32_t tuneIndex = -1;
+            std::string kernelName;
+            if (!Read(file, hash) || !Read(file, tuneIndex) || !ReadString(file, kernelName))
+                return false;
+            imported[hash] = std::make_tuple(kernelName, tuneIndex);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.insert(imported.begin(), imported.end());
+        return true;
+    }
+
+    bool KernelSelectionCache::Export(const std::string& path)
+    {
+        std::stringstream tmpName;
+        tmpName << path << ".tmp" << std::this_thread::get_id();
+        const auto tmpPath = tmpName.str();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!file.good())
+                return false;
+
+            file.write(cacheMagic, sizeof(cacheMagic));
+            Write(file, cacheVersion);
+            WriteString(file, key);
+            Write(file, static_cast<uint32_t>(entries.size()));
+            for (const auto& entry : entries)
+            {
+                Write(file, entry.first);
+                Write(file, static_cast<int32_t>(std::get<1>(entry.second)));
+                WriteString(file, std::get<0>(entry.second));
+            }
+
+            if (!file.good())
+            {
+                file.close();
+                std::remove(tmpPath.c_str());
+                return false;
+            }
+        }
+
+#ifdef _WIN32
+        std::remove(path.c_str());
+#endif
+        if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+
+        modified = false;
+        return true;
+    }
+
+    std::tuple<std::string, int> KernelSelectionCache::Find(uint64_t hash) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(hash);
+        if (it == entries.end())
+            return std::make_tuple(std::string(), -1);
+        return it->second;
+    }
+
+    void KernelSelectionCache::Store(uint64_t hash, const std::string& kernelName, int tuneIndex)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = entries[hash];
+        if (std::get<0>(entry) != kernelName || std::get<1>(entry) != tuneIndex)
+        {
+            entry = std::make_tuple(kernelName, tuneIndex);
+            modified = true;
+        }
+    }
+
+    size_t KernelSelectionCache::Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    bool KernelSelectionCache::IsModified() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return modified;
+    }
+}
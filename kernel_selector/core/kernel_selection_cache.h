@@ -0,0 +1,61 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // KernelSelectionCache
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Kernels selected while building a program, keyed by the hash of the selection request (kernel type, optional
+    // params and params). The cache is exported to a file after the build and imported by the next build of the same
+    // topology, which then generates only the selected kernel for each node instead of evaluating all implementations.
+    // The file is tagged with a caller provided key (device, driver and library version) and ignored when it differs.
+    class KernelSelectionCache
+    {
+    public:
+        explicit KernelSelectionCache(const std::string& key) : key(key) {}
+
+        KernelSelectionCache(const KernelSelectionCache&) = delete;
+        KernelSelectionCache& operator=(const KernelSelectionCache&) = delete;
+
+        // Returns false if the file doesn't exist, is not a valid cache or was written for a different key.
+        bool Import(const std::string& path);
+        // Writes to a temporary file first and renames it afterwards, so concurrent readers never observe partial content.
+        bool Export(const std::string& path);
+
+        // Returns empty kernel name on miss.
+        std::tuple<std::string, int> Find(uint64_t hash) const;
+        void Store(uint64_t hash, const std::string& kernelName, int tuneIndex);
+
+        size_t Size() const;
+        // Cache has entries not written to the file yet.
+        bool IsModified() const;
+
+    private:
+        std::string key;
+        std::unordered_map<uint64_t, std::tuple<std::string, int>> entries;
+        bool modified = false;
+        mutable std::mutex mutex;
+    };
+}
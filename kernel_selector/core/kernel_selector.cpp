@@ -20,6 +20,8 @@
 #include <type_traits>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+#include <cassert>
 
 // #define ENABLE_ENV
 // #define ENABLE_ENV_PRINT
@@ -77,60 +79,236 @@ namespace kernel_selector {
 #endif
     }
 
+    namespace
+    {
+        uint64_t GetSelectionHash(const Params& params, const optional_params& options, KernelType kType)
+        {
+            std::stringstream key;
+            key << toString(kType) << "_"
+                << options.allowStaticInputReordering << options.allowInputReordering << options.allowOutputReordering << "_"
+                << params.to_string();
+            return create_hash(key.str());
+        }
+    }
+
+    KernelsData kernel_selector_base::GetCachedKernel(const Params& params, const optional_params& options, KernelType kType, uint64_t selectionHash) const
+    {
+        if (!options.selectionCache)
+            return{};
+
+        auto cachedKernelConfig = options.selectionCache->Find(selectionHash);
+        const auto& cachedKernelName = std::get<0>(cachedKernelConfig);
+        const int autoTuneIndex = std::get<1>(cachedKernelConfig);
+        if (cachedKernelName.empty())
+            return{};
+
+        const ParamsKey requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
+        for (const auto& implementation : implementations)
+        {
+            if (implementation->GetName() != cachedKernelName)
+                continue;
+
+            if (!implementation->GetSupportedKey().Support(requireKey) || params.GetType() != kType)
+                return{};
+
+            try
+            {
+                KernelsData kds = autoTuneIndex < 0 ? implementation->GetKernelsData(params, options) :
+                                                      implementation->GetTunedKernelsDataByIndex(params, options, autoTuneIndex);
+                if (kds.size() && kds[0].kernels.size())
+                {
+                    kds.resize(1);
+                    kds[0].kernelName = cachedKernelName;
+                    kds[0].kernels[0].layerID = params.layerID;
+                    return kds;
+                }
+            }
+            // a stale record (e.g. tune index out of range) falls back to the regular selection
+            catch (...)
+            {
+            }
+            return{};
+        }
+        return{};
+    }
+
+    void kernel_selector_base::StoreSelectedKernel(const optional_params& options, uint64_t selectionHash, const KernelsData& kernelsData) const
+    {
+        if (options.selectionCache && kernelsData.size())
+            options.selectionCache->Store(selectionHash, kernelsData[0].kernelName, kernelsData[0].autoTuneIndex);
+    }
+
+    KernelsData kernel_selector_base::GetTunedKernel(const Params& params, const optional_params& options, const ParamsKey& requireKey,
+                                                     const std::string& kernelName, int autoTuneIndex) const
+    {
+        for (const auto& implementation : implementations)
+        {
+            // TODO: make sure kernel names are unique.
+            if (implementation->GetName().compare(kernelName) == 0)
+            {
+                if (!implementation->GetSupportedKey().Support(requireKey))
+                    return{};
+
+                try
+                {
+                    KernelsData kds = implementation->GetTunedKernelsDataByIndex(params, options, autoTuneIndex);
+                    if (kds.size() && kds[0].kernels.size())
+                    {
+                        kds[0].kernelName = kernelName;
+                        kds[0].kernels[0].layerID = params.layerID;
+                        return kds;
+                    }
+                }
+                catch (std::runtime_error&)
+                {
+                    // the cached tune index may not be valid for other params
+                }
+                return{};
+            }
+        }
+        return{};
+    }
+
+    KernelsData kernel_selector_base::GetCostModelBestKernel(const Params& params, const optional_params& options, const ParamsKey& requireKey) const
+    {
+        const CostModel* model = autoTuner.LoadCostModel(options.tuningParams.cacheFilePath);
+        if (!model)
+            return{};
+
+        const auto features = CostModel::GetFeatures(params);
+        std::vector<std::pair<CostModel::Candidate, const KernelBase*>> ranked;
+        for (const auto& implementation : implementations)
+        {
+            if (!implementation->GetSupportedKey().Support(requireKey))
+                continue;
+            for (const auto& candidate : model->Rank(implementation->GetName(), features))
+                ranked.emplace_back(candidate, implementation.get());
+        }
+
+        std::stable_sort(ranked.begin(), ranked.end(),
+            [](const std::pair<CostModel::Candidate, const KernelBase*>& a, const std::pair<CostModel::Candidate, const KernelBase*>& b)
+            { return a.first.predictedTime < b.first.predictedTime; });
+
+        // candidates which turn out not to support the params are skipped
+        for (const auto& candidate : ranked)
+        {
+            try
+            {
+                KernelsData kds = candidate.second->GetTunedKernelsDataByIndex(params, options, candidate.first.tuneIndex);
+                if (kds.size() && kds[0].kernels.size())
+                {
+                    kds.resize(1);
+                    kds[0].kernelName = candidate.first.kernelName;
+                    kds[0].kernels[0].layerID = params.layerID;
+                    return kds;
+                }
+            }
+            catch (std::runtime_error&)
+            {
+            }
+        }
+        return{};
+    }
+
     KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params, const optional_params& options, KernelType kType) const
     {
         KernelsData kernelsData;
         std::string kernelName;
 
+        const uint64_t selectionHash = options.selectionCache ? GetSelectionHash(params, options, kType) : 0;
+        kernelsData = GetCachedKernel(params, options, kType, selectionHash);
+        if (!kernelsData.empty())
+            return kernelsData;
+
         if (params.GetType() == kType &&
             options.GetType() == kType)
         {
+            // Selection is done in two phases: priorities of all the matching implementations are
+            // estimated first, then kernels are generated in priority order until one succeeds.
+            // Implementations which can't estimate their priority are generated in the first phase.
+            struct candidate
+            {
+                size_t index;
+                float priority;
+                KernelsData kernelsData;
+            };
+            std::vector<candidate> candidates;
+
             const ParamsKey requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
-            for (const auto& implementation : implementations)
+            for (size_t i = 0; i < implementations.size(); i++)
             {
+                const auto& implementation = implementations[i];
                 const ParamsKey implKey = implementation->GetSupportedKey();
-                // TODO: Unify this check with the Validate virtual method. Make
-                // sure that the method is called here only, not in all the
-                // GetKernelsData implementations.
-                if (implKey.Support(requireKey))
+                if (!implKey.Support(requireKey))
+                    continue;
+
+                try
                 {
-                    try
+                    KernelsData kds;
+#ifdef ENABLE_ENV
+                    const auto& it = forceKernels.find(implementation->GetName());
+                    if (it != forceKernels.end())
                     {
-                        KernelsData kds = implementation->GetKernelsData(params, options);
-
-                        if (kds.size() && kds[0].kernels.size())
+                        if (it->second == true)
                         {
-#ifdef ENABLE_ENV
-                            const auto& it = forceKernels.find(implementation->GetName());
-                            if (it != forceKernels.end())
-                            {
-                                if (it->second == true)
-                                {
-                                    ENV_PRINTF("Force: %s\n", it->first.c_str());
-                                    return kds;
-                                }
-                                else
-                                {
-                                    ENV_PRINTF("Deny: %s\n", it->first.c_str());
-                                }
-                            }
-                            else
-#endif
+                            kds = implementation->GetKernelsData(params, options);
+                            if (kds.size() && kds[0].kernels.size())
                             {
-                                if (kernelsData.size() == 0 ||
-                                    kds[0].estimatedTime < kernelsData[0].estimatedTime)
-                                {
-                                    kernelsData = kds;
-                                    kernelName = implementation->GetName();
-                                }
+                                ENV_PRINTF("Force: %s\n", it->first.c_str());
+                                return kds;
                             }
                         }
+                        else
+                        {
+                            ENV_PRINTF("Deny: %s\n", it->first.c_str());
+                        }
+                        continue;
+                    }
+#endif
+                    float priority = implementation->GetKernelsPriority(params, options);
+                    if (priority == NOT_SUPPORTED)
+                        continue;
+
+                    if (priority == PRIORITY_NOT_ESTIMATED)
+                    {
+                        kds = implementation->GetKernelsData(params, options);
+                        if (!kds.size() || !kds[0].kernels.size())
+                            continue;
+                        priority = kds[0].estimatedTime;
+                    }
+                    candidates.push_back({ i, priority, std::move(kds) });
+                }
+                catch (std::runtime_error&)
+                {
+                    // we have to handle it in order to avoid exception in KernelSelector as much we can
+                }
+            }
+
+            // ties are resolved in favor of the implementation attached first
+            std::stable_sort(candidates.begin(), candidates.end(),
+                [](const candidate& a, const candidate& b) { return a.priority < b.priority; });
+
+            for (auto& c : candidates)
+            {
+                const auto& implementation = implementations[c.index];
+                if (c.kernelsData.empty())
+                {
+                    try
+                    {
+                        c.kernelsData = implementation->GetKernelsData(params, options);
                     }
                     catch (std::runtime_error&)
                     {
-                        // we have to handle it in order to avoid exception in KernelSelector as much we can
+                        continue;
                     }
+                    if (!c.kernelsData.size() || !c.kernelsData[0].kernels.size())
+                        continue;
+                    assert(c.kernelsData[0].estimatedTime == c.priority);
                 }
+
+                kernelsData = std::move(c.kernelsData);
+                kernelName = implementation->GetName();
+                break;
             }
         }
 
@@ -140,6 +318,7 @@ namespace kernel_selector {
             //printf("%s\n", kernelName.c_str());
             kernelsData[0].kernelName = kernelName;
             kernelsData[0].kernels[0].layerID = params.layerID;
+            StoreSelectedKernel(options, selectionHash, kernelsData);
         }
 
         return kernelsData;
@@ -149,17 +328,32 @@ namespace kernel_selector {
     {
         KernelsData kernelsData;
         std::string kernelName;
+
+        // on-line tuning has to run the kernels, so cached selection is used only when tuning is not requested
+        const uint64_t selectionHash = options.selectionCache ? GetSelectionHash(params, options, kType) : 0;
+        if (options.tuningParams.mode != TuningMode::TUNING_TUNE_AND_CACHE)
+        {
+            kernelsData = GetCachedKernel(params, options, kType, selectionHash);
+            if (!kernelsData.empty())
+                return kernelsData;
+        }
+
         if (params.GetType() == kType &&
             options.GetType() == kType)
         {
-            std::string hash = std::to_string(create_hash(params.to_string()));
+            const uint64_t paramsHash = create_hash(params.to_string());
+            std::string hash = std::to_string(paramsHash);
             ParamsKey requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
             std::tuple<std::string, int> cachedKernelConfig;
-            if (options.tuningParams.mode == TuningMode::TUNING_DISABLED) // Try to load kernel/config from offline cache
+            if (options.tuningParams.mode == TuningMode::TUNING_DISABLED ||
+                options.tuningParams.mode == TuningMode::TUNING_COST_MODEL) // Try to load kernel/config from offline cache
             {
 #if ENABLE_OFFLINE_TUNING_CACHE
-                cachedKernelConfig = autoTuner.LoadKernelOffline(params.engineInfo.deviceCache, hash);
-                
+                if (params.engineInfo.deviceBinaryCache)
+                    cachedKernelConfig = autoTuner.LoadKernelOffline(*params.engineInfo.deviceBinaryCache, paramsHash);
+                else
+                    cachedKernelConfig = autoTuner.LoadKernelOffline(params.engineInfo.deviceCache, hash);
+
 #else
                 return  GetNaiveBestKernel(params, options, kType);
 #endif
@@ -172,27 +366,43 @@ namespace kernel_selector {
 
             if (hashFoundInCache)
             {
-                std::string cachedkernelName = std::get<0>(cachedKernelConfig);
-                int autoTuneIndex = std::get<1>(cachedKernelConfig);
+                kernelsData = GetTunedKernel(params, options, requireKey, std::get<0>(cachedKernelConfig), std::get<1>(cachedKernelConfig));
+                if (!kernelsData.empty())
+                {
+                    autoTuner.CountLookup(AutoTuner::LookupResult::EXACT_HIT);
+                    StoreSelectedKernel(options, selectionHash, kernelsData);
+                    return kernelsData;
+                }
+            }
 
-                for (const auto& implementation : implementations)
+            // Layers which differ from a tuned one in sizes only use the kernel of the closest tuned layer.
+            // On-line tuning measures the layer itself instead.
+            if (options.tuningParams.mode != TuningMode::TUNING_TUNE_AND_CACHE)
+            {
+                const size_t maxNearestKernels = 4;
+                const auto descriptor = TuningDescriptor::FromParams(params);
+                const auto nearestKernels = options.tuningParams.mode == TuningMode::TUNING_USE_CACHE ?
+                    autoTuner.LoadNearestKernelsOnline(options.tuningParams.mode, options.tuningParams.cacheFilePath, params.engineInfo.computeUnitsCount, descriptor, maxNearestKernels) :
+                    autoTuner.LoadNearestKernelsOffline(params.engineInfo.deviceCache, descriptor, maxNearestKernels);
+                for (const auto& nearestKernel : nearestKernels)
                 {
-                    // TODO: make sure kernel names are unique.
-                    if (implementation->GetName().compare(cachedkernelName) == 0)
-                    {            
-                        KernelsData kds = implementation->GetTunedKernelsDataByIndex(params, options, autoTuneIndex);
-                        if (kds.size() && kds[0].kernels.size() && implementation->GetSupportedKey().Support(requireKey))
-                        {
-                            kernelsData = kds;
-                            kernelsData[0].kernelName = cachedkernelName;
-                            kernelsData[0].kernels[0].layerID = params.layerID;
-                        }
-                        break;
+                    kernelsData = GetTunedKernel(params, options, requireKey, std::get<0>(nearestKernel), std::get<1>(nearestKernel));
+                    if (!kernelsData.empty())
+                    {
+                        autoTuner.CountLookup(AutoTuner::LookupResult::NEAREST_HIT);
+                        StoreSelectedKernel(options, selectionHash, kernelsData);
+                        return kernelsData;
                     }
                 }
+            }
+            autoTuner.CountLookup(AutoTuner::LookupResult::MISS);
 
+            if (options.tuningParams.mode == TuningMode::TUNING_COST_MODEL)
+            {
+                kernelsData = GetCostModelBestKernel(params, options, requireKey);
                 if (!kernelsData.empty())
                 {
+                    StoreSelectedKernel(options, selectionHash, kernelsData);
                     return kernelsData;
                 }
             }
@@ -208,56 +418,24 @@ namespace kernel_selector {
             // Start on-line tuning
             assert(options.tuningParams.runner);
 
-            for (const auto& implementation : implementations)
-            {
-                const ParamsKey implKey = implementation->GetSupportedKey();
-                if (implKey.Support(requireKey) && implKey.TuningSupport())
-                {
-                    try
-                    {
-                        KernelsData kds = implementation->GetKernelsDataForAutoTune(params, options);
-                        std::vector<uint64_t> runTimes = options.tuningParams.runner->run_kernels(kds);
-                        
-                        for (size_t i = 0; i < kds.size(); i++)
-                        {
-                            kds[i].runTime = runTimes[i];
-                            if (kernelsData.size() == 0 || kds[i].runTime < kernelsData[0].runTime)
-                            {
-                                kernelsData = { kds[i] };
-                                kernelName = implementation->GetName();                                
-                            }
-                        }
-                    }
-                    catch (std::runtime_error&)
-                    {
-                        // we have to handle it in order to avoid exception in KernelSelector as much we can
-                    }
-                }
-            }
-
-            //try to fallback to reference kernels if no optimized were found during tuning
-            if (!kernelsData.size())
+            // Candidates of all the implementations are measured together, so slow ones are pruned early
+            TuningStatistics statistics;
+            auto tuneImplementations = [&](bool tuningSupport)
             {
+                KernelsData candidates;
+                std::vector<std::string> candidateNames;
                 for (const auto& implementation : implementations)
                 {
-
                     const ParamsKey implKey = implementation->GetSupportedKey();
-                    //this time, check only implementations that have disabled tuning
-                    if (implKey.Support(requireKey) && !implKey.TuningSupport())
+                    if (implKey.Support(requireKey) && implKey.TuningSupport() == tuningSupport)
                     {
                         try
                         {
                             KernelsData kds = implementation->GetKernelsDataForAutoTune(params, options);
-                            std::vector<uint64_t> runTimes = options.tuningParams.runner->run_kernels(kds);
-
-                            for (size_t i = 0; i < kds.size(); i++)
+                            for (auto& kd : kds)
                             {
-                                kds[i].runTime = runTimes[i];
-                                if (kernelsData.size() == 0 || kds[i].runTime < kernelsData[0].runTime)
-                                {
-                                    kernelsData = { kds[i] };
-                                    kernelName = implementation->GetName();
-                                }
+                                candidates.push_back(std::move(kd));
+                                candidateNames.push_back(implementation->GetName());
                             }
                         }
                         catch (std::runtime_error&)
@@ -266,13 +444,49 @@ namespace kernel_selector {
                         }
                     }
                 }
+
+                try
+                {
+                    auto result = TuningSearch().Run(*options.tuningParams.runner, candidates);
+
+                    std::vector<std::tuple<std::string, int, uint64_t>> measurements;
+                    for (size_t i = 0; i < candidates.size(); i++)
+                    {
+                        if (result.candidates[i].runs > 0)
+                            measurements.emplace_back(candidateNames[i], candidates[i].autoTuneIndex, result.candidates[i].median);
+                    }
+                    if (!measurements.empty())
+                        autoTuner.StoreSamples(options.tuningParams.cacheFilePath, hash, params.engineInfo.computeUnitsCount, CostModel::GetFeatures(params), measurements);
+
+                    if (result.index != TuningSearch::Result::none)
+                    {
+                        kernelsData = { candidates[result.index] };
+                        kernelsData[0].runTime = result.statistics.median;
+                        kernelName = candidateNames[result.index];
+                        statistics = result.statistics;
+                    }
+                }
+                catch (std::runtime_error&)
+                {
+                }
+            };
+
+            tuneImplementations(true);
+
+            //try to fallback to reference kernels if no optimized were found during tuning
+            if (!kernelsData.size())
+            {
+                //this time, check only implementations that have disabled tuning
+                tuneImplementations(false);
             }
 
             if (kernelsData.size())
             {
                 kernelsData[0].kernelName = kernelName;
                 kernelsData[0].kernels[0].layerID = params.layerID;
-                autoTuner.StoreKernel(options.tuningParams.cacheFilePath, hash, kernelName, kernelsData[0].autoTuneIndex, params.engineInfo.computeUnitsCount);
+                autoTuner.StoreKernel(options.tuningParams.cacheFilePath, hash, kernelName, kernelsData[0].autoTuneIndex, params.engineInfo.computeUnitsCount, statistics,
+                                      TuningDescriptor::FromParams(params));
+                StoreSelectedKernel(options, selectionHash, kernelsData);
             }
         } 
 
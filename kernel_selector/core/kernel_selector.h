@@ -35,6 +35,11 @@ namespace kernel_selector
 
         virtual KernelsData GetBestKernels(const Params& params, const optional_params& options) const = 0;
 
+        // Writes kernels selected by on-line tuning to the tuning cache files.
+        static void FlushTuningCache() { autoTuner.FlushOnlineCache(); }
+        // Exact, nearest descriptor and missed tuning cache lookups since the start of the process.
+        static AutoTuner::LookupStatistics GetTuningCacheStatistics() { return autoTuner.GetLookupStatistics(); }
+
     protected:
         template<typename T>
         inline void Attach()
@@ -46,6 +51,17 @@ namespace kernel_selector
 
         virtual KernelsData GetAutoTuneBestKernel(const Params& params, const optional_params& options, KernelType kType) const;
 
+        // Kernel recorded in options.selectionCache for the request, empty if there is none or it is not valid anymore.
+        KernelsData GetCachedKernel(const Params& params, const optional_params& options, KernelType kType, uint64_t selectionHash) const;
+        void StoreSelectedKernel(const optional_params& options, uint64_t selectionHash, const KernelsData& kernelsData) const;
+
+        // Kernel of the implementation with the given name and tune index, empty if it doesn't support the params.
+        KernelsData GetTunedKernel(const Params& params, const optional_params& options, const ParamsKey& requireKey,
+                                   const std::string& kernelName, int autoTuneIndex) const;
+
+        // Fastest candidate predicted by the cost model in options.tuningParams.cacheFilePath which supports the params.
+        KernelsData GetCostModelBestKernel(const Params& params, const optional_params& options, const ParamsKey& requireKey) const;
+
         KernelList implementations;
         ForceList forceKernels;
 
@@ -49,6 +49,7 @@ namespace kernel_selector {
 #define DONT_USE_IF_HAVE_SOMETHING_ELSE (1000000.f)
 #define TUTORIAL_PRIORITY (DONT_USE_IF_HAVE_SOMETHING_ELSE + 1.f)
 #define NOT_SUPPORTED (FLT_MAX)
+#define PRIORITY_NOT_ESTIMATED (-1.f)
 
     std::string GetStringEnv(const char* varName);
 
@@ -22,6 +22,8 @@
 #include "common_types.h"
 #include "tensor_type.h"
 #include "document.h"
+#include "offline_tuning_cache.h"
+#include "kernel_selection_cache.h"
 
 namespace kernel_selector
 {
@@ -183,10 +185,17 @@ namespace kernel_selector
                         struct lstm_gemm_t {
                             uint32_t bias : 1;
                             uint32_t hidden : 1;
+                            uint32_t projected_input : 1;
                         } lstm_gemm;
                         struct lstm_elt_t {
                             uint32_t cell : 1;
                         } lstm_elt;
+                        struct lstm_sequence_t {
+                            uint32_t bias : 1;
+                            uint32_t hidden : 1;
+                            uint32_t cell : 1;
+                            uint32_t projected_input : 1;
+                        } lstm_sequence;
                         struct fused_conv_eltw_t {
                             // conv
                             uint32_t split : 1;
@@ -316,7 +325,12 @@ namespace kernel_selector
         void EnableEltwiseBroadcast() { key.restrict.val.dedicated.eltwise.broadcast = 1; }
         void EnableLSTMGEMMBias() { key.restrict.val.dedicated.lstm_gemm.bias = 1; }
         void EnableLSTMGEMMHidden() { key.restrict.val.dedicated.lstm_gemm.hidden = 1; }
+        void EnableLSTMGEMMProjectedInput() { key.restrict.val.dedicated.lstm_gemm.projected_input = 1; }
         void EnableLSTMEltCell() { key.restrict.val.dedicated.lstm_elt.cell = 1; }
+        void EnableLSTMSequenceBias() { key.restrict.val.dedicated.lstm_sequence.bias = 1; }
+        void EnableLSTMSequenceHidden() { key.restrict.val.dedicated.lstm_sequence.hidden = 1; }
+        void EnableLSTMSequenceCell() { key.restrict.val.dedicated.lstm_sequence.cell = 1; }
+        void EnableLSTMSequenceProjectedInput() { key.restrict.val.dedicated.lstm_sequence.projected_input = 1; }
         void EnableConcatKernelPerInput() { key.restrict.val.dedicated.concat.kernelPerInput = 1; }
         void DisableTuning() { key.enableTuning = 0; }
         void EnableConcatOneKernel() { key.restrict.val.dedicated.concat.oneKernel = 1; }
@@ -361,6 +375,7 @@ namespace kernel_selector
         std::string driverVersion = "";
         std::string hostVersion = "";
         std::shared_ptr<rapidjson::Document> deviceCache;
+        std::shared_ptr<OfflineTuningCache> deviceBinaryCache;  // Preferred over deviceCache when available.
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -449,6 +464,7 @@ namespace kernel_selector
         bool allowOutputReordering      = false;    // allow kernel to ask graph compiler to reorder the output data before executing the next kernel
 
         TuningParams tuningParams;
+        std::shared_ptr<KernelSelectionCache> selectionCache;   // kernels selected by a previous build of the program, updated with new selections
 
         virtual ParamsKey GetSupportedKey() const;
     protected:
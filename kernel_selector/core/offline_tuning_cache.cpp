@@ -0,0 +1,191 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "offline_tuning_cache.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // Must match tuning_cache_gen.py.
+        const char cacheMagic[8] = { 'C', 'L', 'D', 'N', 'N', 'T', 'C', '\0' };
+        const uint32_t cacheVersion = 1;
+
+        struct Header
+        {
+            char magic[8];
+            uint32_t version;
+            uint32_t sectionsCount;
+            uint32_t namesCount;
+            uint32_t namesOffset;
+        };
+
+        struct Section
+        {
+            uint32_t computeUnits;
+            uint32_t entriesCount;
+            uint64_t entriesOffset;
+        };
+
+        static_assert(sizeof(Header) == 24, "Header layout must match tuning_cache_gen.py");
+        static_assert(sizeof(Section) == 16, "Section layout must match tuning_cache_gen.py");
+    }
+
+    std::shared_ptr<OfflineTuningCache> OfflineTuningCache::Open(const std::string& path, uint32_t computeUnitsCount)
+    {
+        std::shared_ptr<OfflineTuningCache> cache(new OfflineTuningCache());
+        if (!cache->Map(path) || !cache->Init(computeUnitsCount))
+        {
+            return nullptr;
+        }
+        return cache;
+    }
+
+    bool OfflineTuningCache::Map(const std::string& path)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE fileMapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (fileMapping == NULL)
+            return false;
+
+        auto view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == NULL)
+        {
+            CloseHandle(fileMapping);
+            return false;
+        }
+
+        mapping = fileMapping;
+        data = static_cast<const uint8_t*>(view);
+        size = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        auto view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (view == MAP_FAILED)
+            return false;
+
+        mapping = view;
+        data = static_cast<const uint8_t*>(view);
+        size = static_cast<size_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    OfflineTuningCache::~OfflineTuningCache()
+    {
+        if (!data)
+            return;
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(static_cast<HANDLE>(mapping));
+#else
+        munmap(mapping, size);
+#endif
+    }
+
+    bool OfflineTuningCache::Init(uint32_t computeUnitsCount)
+    {
+        if (size < sizeof(Header))
+            return false;
+
+        const auto& header = *reinterpret_cast<const Header*>(data);
+        if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 || header.version != cacheVersion)
+            return false;
+
+        if (sizeof(Header) + static_cast<uint64_t>(header.sectionsCount) * sizeof(Section) > size ||
+            header.namesOffset % alignof(Name) != 0 ||
+            header.namesOffset + static_cast<uint64_t>(header.namesCount) * sizeof(Name) > size)
+            return false;
+
+        const auto sections = reinterpret_cast<const Section*>(data + sizeof(Header));
+        const auto sectionsEnd = sections + header.sectionsCount;
+        auto findSection = [&](uint32_t computeUnits)
+        {
+            return std::find_if(sections, sectionsEnd, [&](const Section& s) { return s.computeUnits == computeUnits; });
+        };
+
+        auto section = findSection(computeUnitsCount);
+        if (section == sectionsEnd)
+            section = findSection(24);
+        if (section == sectionsEnd)
+            return false;
+
+        if (section->entriesOffset % alignof(Entry) != 0 ||
+            section->entriesOffset + static_cast<uint64_t>(section->entriesCount) * sizeof(Entry) > size)
+            return false;
+
+        entries = reinterpret_cast<const Entry*>(data + section->entriesOffset);
+        entriesCount = section->entriesCount;
+        names = reinterpret_cast<const Name*>(data + header.namesOffset);
+        namesCount = header.namesCount;
+
+        for (uint32_t i = 0; i < namesCount; i++)
+        {
+            if (static_cast<uint64_t>(names[i].offset) + names[i].length >= size || data[names[i].offset + names[i].length] != '\0')
+                return false;
+        }
+
+        return true;
+    }
+
+    bool OfflineTuningCache::Find(uint64_t hash, const char*& kernelName, int& tuneIndex) const
+    {
+        const auto entriesEnd = entries + entriesCount;
+        const auto it = std::lower_bound(entries, entriesEnd, hash, [](const Entry& e, uint64_t h) { return e.hash < h; });
+        if (it == entriesEnd || it->hash != hash || it->nameIndex >= namesCount)
+            return false;
+
+        kernelName = reinterpret_cast<const char*>(data + names[it->nameIndex].offset);
+        tuneIndex = it->tuneIndex;
+        return true;
+    }
+}
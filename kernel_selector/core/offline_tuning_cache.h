@@ -0,0 +1,75 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // OfflineTuningCache
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Read-only view of one device section of the binary off-line tuning cache (cache.bin), generated at build time
+    // from cache.json by tuning_cache_gen.py. The file is memory-mapped and looked up by binary search over entries
+    // sorted by params hash, so queries don't parse or allocate anything.
+    class OfflineTuningCache
+    {
+    public:
+        // Returns nullptr if the file doesn't exist or is not a valid cache.
+        // Falls back to the 24 compute units section (same as the json cache) if there is no section for the device.
+        static std::shared_ptr<OfflineTuningCache> Open(const std::string& path, uint32_t computeUnitsCount);
+
+        ~OfflineTuningCache();
+
+        OfflineTuningCache(const OfflineTuningCache&) = delete;
+        OfflineTuningCache& operator=(const OfflineTuningCache&) = delete;
+
+        // On hit, kernelName points to a null-terminated string inside the mapped file.
+        bool Find(uint64_t hash, const char*& kernelName, int& tuneIndex) const;
+        size_t Size() const { return entriesCount; }
+
+    private:
+        struct Entry
+        {
+            uint64_t hash;
+            uint32_t nameIndex;
+            int32_t tuneIndex;
+        };
+
+        struct Name
+        {
+            uint32_t offset;
+            uint32_t length;
+        };
+
+        OfflineTuningCache() = default;
+        bool Map(const std::string& path);
+        bool Init(uint32_t computeUnitsCount);
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        void* mapping = nullptr;
+
+        const Entry* entries = nullptr;
+        uint32_t entriesCount = 0;
+        const Name* names = nullptr;
+        uint32_t namesCount = 0;
+    };
+}
@@ -0,0 +1,62 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "tuning_descriptor.h"
+#include "cost_model.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        bool IsSize(size_t feature)
+        {
+            return feature >= CostModel::OUTPUT_B && feature <= CostModel::INPUT_X;
+        }
+    }
+
+    TuningDescriptor TuningDescriptor::FromParams(const Params& params)
+    {
+        TuningDescriptor descriptor;
+        descriptor.kernelType = toString(params.GetType());
+        descriptor.features = CostModel::GetFeatures(params);
+        return descriptor;
+    }
+
+    bool TuningDescriptor::Compatible(const TuningDescriptor& other) const
+    {
+        if (Empty() || kernelType != other.kernelType || features.size() != other.features.size())
+            return false;
+
+        for (size_t i = 0; i < features.size(); i++)
+        {
+            // off-line caches of other devices may be used, see OfflineTuningCache::Open()
+            if (!IsSize(i) && i != CostModel::COMPUTE_UNITS && features[i] != other.features[i])
+                return false;
+        }
+        return true;
+    }
+
+    float TuningDescriptor::Distance(const TuningDescriptor& other) const
+    {
+        float distance = 0.f;
+        for (size_t i = 0; i < features.size() && i < other.features.size(); i++)
+        {
+            if (IsSize(i))
+                distance += (features[i] - other.features[i]) * (features[i] - other.features[i]);
+        }
+        return distance;
+    }
+}
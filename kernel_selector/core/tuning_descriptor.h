@@ -0,0 +1,44 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "kernel_selector_common.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TuningDescriptor
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Structured description of tuned params, stored in the tuning cache next to the selected kernel. The params hash
+    // matches only identical layers, the descriptor lets layers which differ in sizes only (batch, resolution,
+    // feature maps) use the kernel tuned for the closest layer of the same kind.
+    struct TuningDescriptor
+    {
+        std::string kernelType;
+        std::vector<float> features;    // CostModel::GetFeatures() of the params
+
+        static TuningDescriptor FromParams(const Params& params);
+
+        bool Empty() const { return features.empty(); }
+        // Same kernel type, data type, layout and window, only sizes may differ.
+        bool Compatible(const TuningDescriptor& other) const;
+        // Squared euclidean distance of log2 sizes, meaningful for compatible descriptors only.
+        float Distance(const TuningDescriptor& other) const;
+    };
+}
@@ -0,0 +1,105 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "tuning_search.h"
+#include <algorithm>
+#include <cmath>
+
+namespace kernel_selector
+{
+    constexpr size_t TuningSearch::Result::none;
+
+    TuningStatistics TuningStatistics::FromSamples(std::vector<uint64_t> samples)
+    {
+        TuningStatistics stats;
+        samples.erase(std::remove(samples.begin(), samples.end(), std::numeric_limits<uint64_t>::max()), samples.end());
+        if (samples.empty())
+            return stats;
+
+        std::sort(samples.begin(), samples.end());
+        const size_t n = samples.size();
+        stats.runs = n;
+        stats.median = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+
+        // ranks of the median confidence interval: n/2 -+ 1.96 * sqrt(n)/2
+        const double halfWidth = 0.98 * std::sqrt(static_cast<double>(n));
+        const double lower = std::floor(n / 2.0 - halfWidth);
+        const double upper = std::ceil(n / 2.0 + halfWidth);
+        stats.lowerBound = samples[static_cast<size_t>(std::max(lower, 0.0))];
+        stats.upperBound = samples[std::min(static_cast<size_t>(upper), n - 1)];
+        return stats;
+    }
+
+    TuningSearch::Result TuningSearch::Run(KernelRunnerInterface& runner, const KernelsData& candidates) const
+    {
+        Result result;
+        result.candidates.resize(candidates.size());
+
+        std::vector<std::vector<uint64_t>> samples(candidates.size());
+        std::vector<size_t> alive(candidates.size());
+        for (size_t i = 0; i < alive.size(); i++)
+            alive[i] = i;
+
+        for (int round = 0; !alive.empty(); round++)
+        {
+            KernelsData batch;
+            batch.reserve(alive.size());
+            for (auto idx : alive)
+                batch.push_back(candidates[idx]);
+
+            auto measured = runner.run_kernels_samples(batch, round == 0 ? config.warmupRuns : 0, config.runsPerRound);
+            for (size_t i = 0; i < alive.size() && i < measured.size(); i++)
+            {
+                auto& s = samples[alive[i]];
+                s.insert(s.end(), measured[i].begin(), measured[i].end());
+                result.candidates[alive[i]] = TuningStatistics::FromSamples(s);
+                result.kernelRuns += measured[i].size();
+            }
+
+            // kernels which could not be run are out
+            alive.erase(std::remove_if(alive.begin(), alive.end(),
+                [&](size_t idx) { return result.candidates[idx].runs == 0; }), alive.end());
+            if (alive.size() <= 1 || round + 1 >= config.maxRounds)
+                break;
+
+            std::stable_sort(alive.begin(), alive.end(),
+                [&](size_t a, size_t b) { return result.candidates[a].median < result.candidates[b].median; });
+
+            const auto& best = result.candidates[alive[0]];
+            const bool separated = std::all_of(alive.begin() + 1, alive.end(),
+                [&](size_t idx) { return result.candidates[idx].lowerBound > best.upperBound; });
+            if (separated)
+            {
+                alive.resize(1);
+                break;
+            }
+
+            alive.resize((alive.size() + 1) / 2);
+            alive.erase(std::remove_if(alive.begin() + 1, alive.end(),
+                [&](size_t idx) { return result.candidates[idx].lowerBound > best.upperBound; }), alive.end());
+        }
+
+        for (auto idx : alive)
+        {
+            if (result.index == Result::none || result.candidates[idx].median < result.candidates[result.index].median)
+                result.index = idx;
+        }
+        if (result.index != Result::none)
+            result.statistics = result.candidates[result.index];
+
+        return result;
+    }
+}
@@ -0,0 +1,77 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "kernel_selector_common.h"
+#include "kernel_runner_interface.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TuningStatistics
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Distribution of measured run times of a kernel (in nano-seconds). The bounds are the ~95% confidence
+    // interval of the median, taken from order statistics of the samples.
+    struct TuningStatistics
+    {
+        uint64_t median = std::numeric_limits<uint64_t>::max();
+        uint64_t lowerBound = std::numeric_limits<uint64_t>::max();
+        uint64_t upperBound = std::numeric_limits<uint64_t>::max();
+        size_t runs = 0;
+
+        static TuningStatistics FromSamples(std::vector<uint64_t> samples);
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TuningSearch
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Picks the fastest of the tuning candidates by successive halving: all candidates are warmed up and measured
+    // a few times, then the slower half (and every candidate whose interval is entirely above the interval of the
+    // current best) is dropped and the survivors are measured again, until a single candidate is left, the best
+    // one is separated from all the others or the rounds limit is reached.
+    class TuningSearch
+    {
+    public:
+        struct Config
+        {
+            int warmupRuns = 1;     // untimed runs of each kernel before its first measurement
+            int runsPerRound = 3;   // timed runs of each surviving candidate in every round
+            int maxRounds = 5;
+        };
+
+        struct Result
+        {
+            static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+            size_t index = none;                        // index of the selected candidate, none if no candidate could be run
+            TuningStatistics statistics;                // measurements of the selected candidate
+            std::vector<TuningStatistics> candidates;   // measurements of all the candidates, pruned ones keep their last state
+            size_t kernelRuns = 0;                      // total number of timed runs done by the search
+        };
+
+        TuningSearch() = default;
+        explicit TuningSearch(const Config& config) : config(config) {}
+
+        Result Run(KernelRunnerInterface& runner, const KernelsData& candidates) const;
+
+    private:
+        Config config;
+    };
+}
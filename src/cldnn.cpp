@@ -22,6 +22,7 @@
 #include "program_impl.h"
 #include "primitive_type.h"
 #include "network_impl.h"
+#include "pipeline_impl.h"
 #include "memory_impl.h"
 #include "primitive_inst.h"
 
@@ -324,7 +325,7 @@ void cldnn_release_event(cldnn_event event, cldnn_status* status)
 
 void cldnn_wait_for_event(cldnn_event event, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(event, "Event");
         api_cast(event)->wait();
@@ -333,7 +334,7 @@ void cldnn_wait_for_event(cldnn_event event, cldnn_status* status)
 
 void cldnn_set_event(cldnn_event event, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(event, "Event");
         if (auto user_ev = dynamic_cast<user_event*>(api_cast(event)))
@@ -345,7 +346,7 @@ void cldnn_set_event(cldnn_event event, cldnn_status* status)
 
 void cldnn_add_event_handler(cldnn_event event, cldnn_event_handler handler, void* param, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(handler, "Handler");
         SHOULD_NOT_BE_NULL(event,   "Event");
@@ -355,7 +356,7 @@ void cldnn_add_event_handler(cldnn_event event, cldnn_event_handler handler, voi
 
 void cldnn_get_event_profiling_info(cldnn_event event, cldnn_profiling_interval* profiling, size_t size, size_t* size_ret, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(event, "Event");
         if (!profiling && !size_ret)
@@ -399,7 +400,7 @@ cldnn_program cldnn_build_program(cldnn_engine engine, cldnn_topology topology,
 
 void cldnn_retain_program(cldnn_program program, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(program, "Program");
         api_cast(program)->add_ref();
@@ -408,7 +409,7 @@ void cldnn_retain_program(cldnn_program program, cldnn_status* status)
 
 void cldnn_release_program(cldnn_program program, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(program, "Program");
         api_cast(program)->release();
@@ -438,7 +439,7 @@ cldnn_network cldnn_build_network(cldnn_engine engine, cldnn_topology topology,
 
 void cldnn_retain_network(cldnn_network network, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         api_cast(network)->add_ref();
@@ -447,7 +448,7 @@ void cldnn_retain_network(cldnn_network network, cldnn_status* status)
 
 void cldnn_release_network(cldnn_network network, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         api_cast(network)->release();
@@ -456,7 +457,7 @@ void cldnn_release_network(cldnn_network network, cldnn_status* status)
 
 void cldnn_set_network_input(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(mem, "Mem");
         auto mem_size = api_cast(mem)->size();
@@ -467,9 +468,20 @@ void cldnn_set_network_input(cldnn_network network, cldnn_primitive_id id, cldnn
     });
 }
 
+void cldnn_set_network_output_memory(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(mem,         "Mem");
+        SHOULD_NOT_BE_NULL(network,     "Network");
+        SHOULD_NOT_BE_NULL(id,          "Id");
+        api_cast(network)->set_output_memory(id, *api_cast(mem));
+    });
+}
+
 void cldnn_set_learning_rate(cldnn_network network, float lr, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         api_cast(network)->set_learning_rate(lr);
     });
@@ -529,7 +541,7 @@ void cldnn_get_primitive_info(cldnn_network network, cldnn_primitive_id prim_id,
 
 void cldnn_get_network_output_names(cldnn_network network, char* names, size_t size, size_t* size_ret, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         auto&& output_ids = api_cast(network)->get_output_ids();
@@ -540,7 +552,7 @@ void cldnn_get_network_output_names(cldnn_network network, char* names, size_t s
 
 void cldnn_get_network_executed_primitive_names(cldnn_network network, char* names, size_t size, size_t* size_ret, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         auto&& primitive_ids = api_cast(network)->get_executed_primitive_ids();
@@ -550,7 +562,7 @@ void cldnn_get_network_executed_primitive_names(cldnn_network network, char* nam
 
 void cldnn_get_network_all_primitive_names(cldnn_network network, char* names, size_t size, size_t* size_ret, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         auto&& primitive_ids = api_cast(network)->get_all_primitive_ids();
@@ -561,7 +573,7 @@ void cldnn_get_network_all_primitive_names(cldnn_network network, char* names, s
 
 void cldnn_get_network_all_primitive_org_names(cldnn_network network, char* names, size_t size, size_t* size_ret, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         auto&& primitive_ids = api_cast(network)->get_all_primitive_org_ids();
@@ -572,7 +584,7 @@ void cldnn_get_network_all_primitive_org_names(cldnn_network network, char* name
 
 void cldnn_execute_network(cldnn_network network, cldnn_event* dependencies, size_t deps_num, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(network, "Network");
         std::vector<cldnn::refcounted_obj_ptr<cldnn::event_impl>> deps;
@@ -631,26 +643,140 @@ cldnn_event cldnn_get_network_output_event(cldnn_network network, const char* na
     });
 }
 
+cldnn_pipeline cldnn_create_pipeline(cldnn_program program, uint32_t requests_num, cldnn_status* status)
+{
+    return exception_handler<cldnn_pipeline>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(program, "Program");
+        SHOULD_NOT_EQUAL_0(requests_num, "Number of requests");
+        pipeline_impl* p = new pipeline_impl(*api_cast(program), requests_num);
+        return api_cast(p);
+    });
+}
+
+void cldnn_retain_pipeline(cldnn_pipeline pipeline, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(pipeline, "Pipeline");
+        api_cast(pipeline)->add_ref();
+    });
+}
+
+void cldnn_release_pipeline(cldnn_pipeline pipeline, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(pipeline, "Pipeline");
+        api_cast(pipeline)->release();
+    });
+}
+
+cldnn_layout cldnn_get_pipeline_layout(cldnn_pipeline pipeline, cldnn_primitive_id id, cldnn_status* status)
+{
+    cldnn_layout error_result = cldnn::layout(cldnn::data_types::f32, cldnn::format::bfyx, { 0, 0, 0, 0 });
+
+    return exception_handler<cldnn_layout>(CLDNN_ERROR, status, error_result, [&]() -> cldnn_layout
+    {
+        SHOULD_NOT_BE_NULL(pipeline, "Pipeline");
+        SHOULD_NOT_BE_NULL(id, "ID of primitive");
+        return api_cast(pipeline)->get_layout(id);
+    });
+}
+
+void cldnn_submit_pipeline_request(cldnn_pipeline pipeline, const cldnn_request_data* inputs, size_t inputs_num, const cldnn_request_data* outputs, size_t outputs_num, cldnn_request_handler handler, void* param, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(pipeline, "Pipeline");
+        if (inputs_num > 0)
+            SHOULD_NOT_BE_NULL(inputs, "Inputs");
+        if (outputs_num > 0)
+            SHOULD_NOT_BE_NULL(outputs, "Outputs");
+
+        std::vector<std::pair<cldnn::primitive_id, const void*>> inputs_data;
+        for (size_t i = 0; i < inputs_num; ++i)
+        {
+            SHOULD_NOT_BE_NULL(inputs[i].id, "ID of input");
+            SHOULD_NOT_BE_NULL(inputs[i].data, "Input data");
+            inputs_data.emplace_back(inputs[i].id, inputs[i].data);
+        }
+        std::vector<std::pair<cldnn::primitive_id, void*>> outputs_data;
+        for (size_t i = 0; i < outputs_num; ++i)
+        {
+            SHOULD_NOT_BE_NULL(outputs[i].id, "ID of output");
+            SHOULD_NOT_BE_NULL(outputs[i].data, "Output data");
+            outputs_data.emplace_back(outputs[i].id, outputs[i].data);
+        }
+
+        pipeline_impl::completion_handler completion;
+        if (handler != nullptr)
+            completion = [handler, param](cldnn_status request_status) { handler(request_status, param); };
+        api_cast(pipeline)->submit(inputs_data, outputs_data, std::move(completion));
+    });
+}
+
+void cldnn_wait_pipeline(cldnn_pipeline pipeline, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(pipeline, "Pipeline");
+        api_cast(pipeline)->wait();
+    });
+}
+
+static void check_memory_layout(const cldnn_layout& layout)
+{
+    if (layout.format < cldnn_format_any || layout.format >= cldnn_format_format_num)
+        throw std::invalid_argument("Unknown format of layout.");
+    if (layout.data_type != cldnn_data_type::cldnn_f16 &&
+        layout.data_type != cldnn_data_type::cldnn_f32 &&
+        layout.data_type != cldnn_data_type::cldnn_i8 &&
+        layout.data_type != cldnn_data_type::cldnn_u8 &&
+        layout.data_type != cldnn_data_type::cldnn_i32 &&
+        layout.data_type != cldnn_data_type::cldnn_i64)
+        throw std::invalid_argument("Unknown data_type of layout.");
+}
+
 cldnn_memory cldnn_allocate_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status)
 {
     return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
-        if (layout.format < cldnn_format_any || layout.format >= cldnn_format_format_num)
-            throw std::invalid_argument("Unknown format of layout.");
-        if (layout.data_type != cldnn_data_type::cldnn_f16 &&
-            layout.data_type != cldnn_data_type::cldnn_f32 &&
-            layout.data_type != cldnn_data_type::cldnn_i8 &&
-            layout.data_type != cldnn_data_type::cldnn_u8 &&
-            layout.data_type != cldnn_data_type::cldnn_i32 &&
-            layout.data_type != cldnn_data_type::cldnn_i64)
-            throw std::invalid_argument("Unknown data_type of layout.");
+        check_memory_layout(layout);
 
         cldnn::memory_impl* mem_ptr = api_cast(engine)->allocate_memory(layout).detach();
         return api_cast(mem_ptr);
     });
 }
 
+cldnn_memory cldnn_allocate_host_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        check_memory_layout(layout);
+
+        cldnn::memory_impl* mem_ptr = api_cast(engine)->allocate_host_memory(layout).detach();
+        return api_cast(mem_ptr);
+    });
+}
+
+cldnn_memory cldnn_attach_host_memory(cldnn_engine engine, cldnn_layout layout, void* pointer, size_t size, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(pointer, "Pointer");
+        check_memory_layout(layout);
+        if (cldnn::layout(layout).bytes_count() > size)
+            throw std::invalid_argument("buffer size does not match layout size");
+
+        cldnn::memory_impl* mem_ptr = api_cast(engine)->allocate_host_memory(layout, pointer).detach();
+        return api_cast(mem_ptr);
+    });
+}
+
 cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size, cldnn_status* status)
 {
     return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
@@ -686,7 +812,7 @@ CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2,
 
 void cldnn_retain_memory(cldnn_memory memory, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(memory, "Memory");
         api_cast(memory)->add_ref();
@@ -695,7 +821,7 @@ void cldnn_retain_memory(cldnn_memory memory, cldnn_status* status)
 
 void cldnn_release_memory(cldnn_memory memory, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(memory, "Memory");
         api_cast(memory)->release();
@@ -711,9 +837,20 @@ void* cldnn_lock_memory(cldnn_memory memory, cldnn_status* status)
     });
 }
 
+void* cldnn_lock_memory_mode(cldnn_memory memory, int32_t mode, cldnn_status* status)
+{
+    return exception_handler<void*>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(memory, "Memory");
+        if (mode < cldnn_lock_read_write || mode > cldnn_lock_write)
+            throw std::invalid_argument("Unknown lock mode.");
+        return api_cast(memory)->lock(static_cast<cldnn::lock_mode>(mode));
+    });
+}
+
 void cldnn_unlock_memory(cldnn_memory memory, cldnn_status* status)
 {
-    exception_handler(CLDNN_ERROR, status, [&]()
+    return exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(memory, "Memory");
         api_cast(memory)->unlock();
@@ -771,6 +908,26 @@ CLDNN_API float cldnn_half_to_float(uint16_t value, cldnn_status* status)
     });
 }
 
+void cldnn_float_to_half_array(const float* src, uint16_t* dst, size_t count, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(src, "Source");
+        SHOULD_NOT_BE_NULL(dst, "Destination");
+        cldnn::float_to_half(src, dst, count);
+    });
+}
+
+void cldnn_half_to_float_array(const uint16_t* src, float* dst, size_t count, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(src, "Source");
+        SHOULD_NOT_BE_NULL(dst, "Destination");
+        cldnn::half_to_float(src, dst, count);
+    });
+}
+
 } /* extern "C" */
 
 #define PRIMITIVE_TYPE_ID_CALL_IMPL(PType) \
@@ -158,6 +158,7 @@ void concatenation_inst::on_execute()
 void concatenation_inst::reuse_input()
 {
     _output = _network.get_engine().reinterpret_buffer(input_memory(), node.get_output_layout());
+    _output_changed = true;
 }
 
 }
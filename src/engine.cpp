@@ -35,13 +35,19 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf)
     result.meaningful_kernels_names = conf.meaningful_kernels_names != 0;
     result.dump_custom_program = conf.dump_custom_program != 0;
     result.single_kernel_name = conf.single_kernel_name;
-    result.host_out_of_order = true; //TODO: enable when barriers in driver will be fixed
+    // a single main queue is out-of-order (only with the NEO driver, see gpu_toolkit::is_out_of_order), several queues
+    // are in-order and synchronized by events at the joins of branches; buffer clearing fills are ordered by their
+    // events in both cases
+    result.host_out_of_order = conf.n_queues <= 1;
     result.log = conf.engine_log;
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
     result.priority_mode = static_cast<cldnn_priority_mode_type>(conf.priority_mode);
     result.throttle_mode = static_cast<cldnn_throttle_mode_type>(conf.throttle_mode);
     result.user_context = static_cast<cl::Context*>(conf.context);
     result.tuning_cache_path = conf.tuning_cache_path;
+    result.kernels_cache_dir = conf.kernels_cache_dir;
+    result.n_threads = conf.n_threads;
+    result.n_queues = std::max<uint16_t>(conf.n_queues, 1);
     return result;
 }
 
@@ -70,11 +76,24 @@ memory_impl::ptr engine_impl::allocate_memory(layout layout)
     return _memory_pool.get_memory(layout);
 }
 
-memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t network_id, std::set<primitive_id> dependencies, bool reusable)
+memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& dependencies, bool reusable)
 {
     if (use_memory_pool())
-        return _memory_pool.get_memory(layout, id, network_id, dependencies, reusable);
-    return _memory_pool.get_memory(layout);
+        return _memory_pool.get_memory(layout, id, memory_index, network_id, dependencies, reusable);
+    // outputs of primitives are cleared only if their padding has to be zero
+    return _memory_pool.get_memory(layout, static_cast<bool>(layout.data_padding));
+}
+
+memory_impl::ptr engine_impl::allocate_host_memory(layout layout, void* host_ptr)
+{
+    if (layout.format.is_image())
+        throw error("host memory can't be allocated for image formats", CLDNN_ERROR);
+
+    // zero-copy sharing of user memory needs page aligned storage
+    if (host_ptr != nullptr && reinterpret_cast<uintptr_t>(host_ptr) % BUFFER_ALIGNMENT != 0)
+        throw error("host memory has to be aligned to " + std::to_string(BUFFER_ALIGNMENT) + " bytes", CLDNN_ERROR);
+
+    return _memory_pool.get_host_memory(layout, host_ptr);
 }
 
 memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, layout new_layout)
@@ -149,9 +168,9 @@ network_impl::ptr engine_impl::build_network(const std::set<std::shared_ptr<prog
     return{ new network_impl(*this, nodes, options, is_internal), false };
 }
 
-network_impl::ptr engine_impl::allocate_network(const program_impl& program, bool is_internal)
+network_impl::ptr engine_impl::allocate_network(const program_impl& program, bool is_internal, bool is_concurrent)
 {
-    return{ new network_impl(program, is_internal), false };
+    return{ new network_impl(program, is_internal, is_concurrent), false };
 }
 
 void engine_impl::wait_for_events(std::vector<event_impl::ptr> const & events)
@@ -14,130 +14,152 @@
 
 #include "condition_inst.h"
 #include "network_impl.h"
+#include "engine_impl.h"
 #include "implementation_map.h"
-#include "math_utils.h"
+#include "kernel.h"
+#include "kernel_selector_helper.h"
+#include "condition/condition_kernel_selector.h"
+#include "condition/condition_kernel_base.h"
+#include "error_handler.h"
 
 #include <algorithm>
 
 namespace cldnn { namespace gpu {
 
+namespace {
+    kernel_selector::ConditionFunction get_kernel_selector_condition_function(cond_functions func)
+    {
+        switch (func)
+        {
+        case cond_functions::EQUAL:   return kernel_selector::ConditionFunction::EQUAL;
+        case cond_functions::GREATER: return kernel_selector::ConditionFunction::GREATER;
+        case cond_functions::LESS:    return kernel_selector::ConditionFunction::LESS;
+        default:
+            throw std::invalid_argument("Unknown comparision function");
+        }
+    }
+
+    layout predicate_layout() { return { data_types::i32, format::bfyx, { 1, 1, 1, 1 } }; }
+}
+
 struct condition_gpu : typed_primitive_impl<condition>
 {
     const condition_node& outer;
-
-    condition_gpu(const condition_node& outer)
-        : outer(outer)
+    kernel_selector::kernel_data _kernel_data;
+    gpu::kernel _kernel;
+    // result of the predicate kernel, 1 if the condition holds for all compared elements
+    memory_impl::ptr _predicate;
+
+    condition_gpu(const condition_node& outer, const kernel_selector::kernel_data& kd)
+        : typed_primitive_impl<condition>(kd.weightsReorderParams, kd.kernelName)
+        , outer(outer)
+        , _kernel_data(kd)
+        , _kernel(outer.get_program().get_engine().get_context(), kd.kernels[0].kernelString)
+        , _predicate(outer.get_program().get_engine().allocate_memory(predicate_layout()))
     {}
 
     event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, condition_inst& instance) override
     {
-        for (auto& a : events)
+        // the predicate is reduced on the device, only the resulting flag is read back
+        gpu::kernel::kernel_arguments_data args;
+        args.inputs = { &instance.input_memory(), &instance.compare_memory() };
+        args.output = _predicate;
+        _kernel.set_output_event(true);
+        _kernel.run(_kernel_data.kernels[0], events, args)->wait();
+
+        bool exec_true;
         {
-            a->wait();
+            mem_lock<int32_t> lock{ _predicate, lock_mode::read };
+            exec_true = *lock.begin() != 0;
         }
-        auto ev = instance.get_network().get_engine().create_user_event(false);
 
-        bool exec_branch = choose_branch_to_exec(instance);
-        memory_impl::ptr memory_to_copy;
-        if (exec_branch)
-            memory_to_copy = &execute_branch(instance.get_net_true(), instance.result_id(), instance.input_memory());
-        else
-            memory_to_copy = &execute_branch(instance.get_net_false(), instance.result_id(), instance.input_memory());
-        //just copy memory
-        mem_lock<float> inp_ptr{ memory_to_copy };
-        mem_lock<float> out_ptr{ instance.output_memory() };
-        std::copy(inp_ptr.begin(), inp_ptr.end(), out_ptr.begin());
-        dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
-        return ev;
+        return execute_branch(exec_true ? *instance.get_net_true() : *instance.get_net_false(), instance);
     }
 
     static primitive_impl* create(const condition_node& arg)
-    { 
-        return new condition_gpu(arg);
+    {
+        auto cond_params = get_default_params<kernel_selector::condition_params>(arg);
+        auto cond_optional_params = get_default_optional_params<kernel_selector::condition_optional_params>(arg.get_program());
+
+        cond_params.inputs.push_back(convert_data_tensor(arg.compare().get_output_layout()));
+        cond_params.output = convert_data_tensor(predicate_layout());
+        cond_params.function = get_kernel_selector_condition_function(arg.func());
+        cond_params.offset = convert_dim_vector(arg.offset());
+
+        auto& kernel_selector = kernel_selector::condition_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(cond_params, cond_optional_params);
+
+        CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
+
+        return new condition_gpu(arg, best_kernels[0]);
     }
 
 private:
-    /*
-    Add functions here.
-    */
-    bool check_condition(const float value_1, const float value_2, const cond_functions& func) const
+    // users of the condition may need its output padded, while the branch output isn't (condition is implemented
+    // only for plain formats, so elements are addressed by pitches of the layouts)
+    static void copy_output(memory_impl& src, memory_impl& dst)
     {
-        switch (func)
+        const auto& src_layout = src.get_layout();
+        const auto& dst_layout = dst.get_layout();
+        if (src_layout == dst_layout)
         {
-        case cond_functions::EQUAL: return value_1 == value_2;
-            break;
-        case cond_functions::GREATER: return value_1 > value_2;
-            break;
-        case cond_functions::LESS: return value_1 < value_2;
-            break;
-        default:
-            throw("Unknown comparision function for: " + outer.id());
-            break;
+            mem_lock<char> src_ptr{ src, lock_mode::read };
+            mem_lock<char> dst_ptr{ dst, lock_mode::write };
+            std::copy(src_ptr.begin(), src_ptr.end(), dst_ptr.begin());
+            return;
         }
+
+        // padding of the output is kept, so it isn't locked for write only
+        mem_lock<char> src_ptr{ src, lock_mode::read };
+        mem_lock<char> dst_ptr{ dst };
+        const auto element_size = data_type_traits::size_of(dst_layout.data_type);
+        const auto& size = dst_layout.size;
+        for (tensor::value_type b = 0; b < size.batch[0]; b++)
+            for (tensor::value_type f = 0; f < size.feature[0]; f++)
+                for (tensor::value_type z = 0; z < size.spatial[2]; z++)
+                    for (tensor::value_type y = 0; y < size.spatial[1]; y++)
+                        for (tensor::value_type x = 0; x < size.spatial[0]; x++)
+                        {
+                            const tensor element(b, f, x, y, z);
+                            std::copy_n(src_ptr.data() + src_layout.get_linear_offset(element) * element_size, element_size,
+                                        dst_ptr.data() + dst_layout.get_linear_offset(element) * element_size);
+                        }
     }
 
     /*
-    Loop over memory and check condition.
-    Returns boolean flag, which says what branch should be executed.
+    The selected branch writes its result directly to the output of the condition. The output is copied only if
+    the branch output can't be redirected (e.g. it is the branch input or shares memory with an optimized out primitive).
     */
-    bool choose_branch_to_exec(condition_inst& instance) const
+    event_impl::ptr execute_branch(network_impl& branch, condition_inst& instance) const
     {
-        mem_lock<float> lock_compare_data{ instance.compare_memory() };
-        auto compare_layout = instance.compare_memory().get_layout();
-        auto compare_ptr = lock_compare_data.begin();
+        branch.set_input_data(instance.result_id(), instance.input_memory());
+        auto& branch_output = *branch.get_outputs().at(0);
+        const bool direct_output = branch_output.set_output_memory(instance.output_memory());
 
-        mem_lock<float> lock_input{ instance.input_memory() };
-        auto input_layout = instance.input_memory().get_layout();
-        auto input_ptr = lock_input.begin();
+        branch.execute({});
+        auto& branch_event = branch.get_primitive_event(branch_output.id());
+        if (direct_output)
+            return branch_event;
 
-        auto function = instance.argument.function;
-        auto& offset = instance.argument.offset;
-        auto& range = compare_layout.size;
+        branch_event->wait();
+        copy_output(branch_output.output_memory(), instance.output_memory());
 
-        for (auto b = 0; b < range.batch[0]; b++)
-        {
-            for (auto f = 0; f < range.feature[0]; f++)
-            {
-                for (auto z = 0; z < range.spatial[2]; z++)
-                {
-                    for (auto y = 0; y < range.spatial[1]; y++)
-                    {
-                        for (auto x = 0; x < range.spatial[0]; x++)
-                        {
-                            auto input_idx = input_layout.get_linear_offset({
-                                b + offset.batch[0],
-                                f + offset.feature[0],
-                                x + offset.spatial[0],
-                                y + offset.spatial[1],
-                                z + offset.spatial[2]
-                            });
-                            auto compare_idx = compare_layout.get_linear_offset({ b, f, x, y, z });
-                            if (!check_condition(input_ptr[input_idx], compare_ptr[compare_idx], function)) return false;
-                        }
-                    }
-                }
-            }
-        }
-        return true;
-    }
-
-    
-
-    memory_impl& execute_branch(network_impl::ptr branch, const primitive_id& input_id, memory_impl& input_memory) const
-    {
-        branch->set_input_data(input_id, input_memory);
-        branch->execute({});
-        return branch->get_outputs().at(0)->output_memory();
+        auto ev = instance.get_network().get_engine().create_user_event(false);
+        dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
+        return ev;
     }
 };
 
 namespace {
     struct attach {
         attach() {
-            implementation_map<condition>::add(std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx),
-                condition_gpu::create);
-            implementation_map<condition>::add(std::make_tuple(engine_types::ocl, data_types::f32, format::yxfb),
-                condition_gpu::create);
+            auto val_fw = condition_gpu::create;
+
+            for (auto dt : { data_types::f32, data_types::f16, data_types::i8, data_types::u8, data_types::i32, data_types::i64 })
+            {
+                implementation_map<condition>::add(std::make_tuple(engine_types::ocl, dt, format::bfyx), val_fw);
+                implementation_map<condition>::add(std::make_tuple(engine_types::ocl, dt, format::yxfb), val_fw);
+            }
         }
         ~attach() = default;
     };
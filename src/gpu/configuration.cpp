@@ -32,6 +32,9 @@ namespace cldnn {
             , ocl_sources_dumps_dir("")
             , user_context(nullptr)            
             , tuning_cache_path("cache.json")        
+            , kernels_cache_dir("")
+            , n_threads(1)
+            , n_queues(1)
         {}
     }
 }
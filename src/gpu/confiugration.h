@@ -45,6 +45,9 @@ namespace cldnn {
             cldnn_throttle_mode_type throttle_mode;
             cl::Context* user_context;
             std::string tuning_cache_path;
+            std::string kernels_cache_dir;
+            uint16_t n_threads;
+            uint16_t n_queues;      // number of in-order queues, more than one requires host_out_of_order to be disabled
         };
     }
 }
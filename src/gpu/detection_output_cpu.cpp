@@ -16,6 +16,7 @@
 
 #include "detection_output_inst.h"
 #include "kernel.h"
+#include "primitive_gpu_base.h"
 #include "network_impl.h"
 #include "implementation_map.h"
 #include "math_utils.h"
@@ -589,34 +590,26 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
 
     event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, detection_output_inst& instance) override
     {
-        for (auto& a : events) 
+        return run_host_task(instance, events, [this, &instance]()
         {
-            a->wait();
-        }
-
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+            const int num_of_images = instance.location_memory().get_layout().size.batch[0]; //batch size
 
-        const int num_of_images = instance.location_memory().get_layout().size.batch[0]; //batch size
+            std::vector<std::vector<std::vector<bounding_box>>> bboxes(num_of_images); // Per image : label -> decoded bounding boxes.
+            std::vector<std::vector<std::vector<std::pair<float, int>>>> confidences(num_of_images); // Per image : class -> confidences per bounding box.
 
-        std::vector<std::vector<std::vector<bounding_box>>> bboxes(num_of_images); // Per image : label -> decoded bounding boxes.
-        std::vector<std::vector<std::vector<std::pair<float, int>>>> confidences(num_of_images); // Per image : class -> confidences per bounding box.
-
-        if (instance.location_memory().get_layout().data_type == data_types::f32)
-        {
-            prepare_data<data_type_to_type<data_types::f32>::type>(instance, bboxes, confidences);
-
-            generate_detections<data_type_to_type<data_types::f32>::type>(instance, num_of_images, bboxes, confidences);
-        }
-        else
-        {
-            prepare_data<data_type_to_type<data_types::f16>::type>(instance, bboxes, confidences);
+            if (instance.location_memory().get_layout().data_type == data_types::f32)
+            {
+                prepare_data<data_type_to_type<data_types::f32>::type>(instance, bboxes, confidences);
 
-            generate_detections<data_type_to_type<data_types::f16>::type>(instance, num_of_images, bboxes, confidences);
-        }
+                generate_detections<data_type_to_type<data_types::f32>::type>(instance, num_of_images, bboxes, confidences);
+            }
+            else
+            {
+                prepare_data<data_type_to_type<data_types::f16>::type>(instance, bboxes, confidences);
 
-        dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
-        // TODO: consider refactoring create_user_event() to return cldnn::user_event*
-        return ev;
+                generate_detections<data_type_to_type<data_types::f16>::type>(instance, num_of_images, bboxes, confidences);
+            }
+        });
     }
 
     static primitive_impl* create(const detection_output_node& arg)
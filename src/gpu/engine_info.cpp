@@ -132,7 +132,7 @@ std::string to_string_hex(int val)
 
 #include "mode.inc"
 
-std::shared_ptr<rapidjson::Document> get_cache_from_file(uint32_t compute_units_count, const gpu_toolkit& context) {
+std::string get_tuning_cache_path(const gpu_toolkit& context) {
     std::string tuning_cache_path = context.get_configuration().tuning_cache_path;
     if (tuning_cache_path.compare("cache.json") == 0)
     {
@@ -141,7 +141,7 @@ std::shared_ptr<rapidjson::Document> get_cache_from_file(uint32_t compute_units_
         HMODULE hm = NULL;
         GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
             GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
-            (LPCSTR)&get_cache_from_file, &hm);
+            (LPCSTR)&get_tuning_cache_path, &hm);
         GetModuleFileName(hm, path, sizeof(path));
         std::string bin_path(path);
         tuning_cache_path = bin_path.substr(0, bin_path.find_last_of("\\")) + "\\cache.json";
@@ -150,12 +150,36 @@ std::shared_ptr<rapidjson::Document> get_cache_from_file(uint32_t compute_units_
         #ifdef __GNUC__
             __extension__
         #endif
-        dladdr((void *)get_cache_from_file, &dl_info);
+        dladdr((void *)get_tuning_cache_path, &dl_info);
         std::string path(dl_info.dli_fname);
         tuning_cache_path = path.substr(0, path.find_last_of('/'));
         tuning_cache_path += "/cache.json";
 #endif
     }
+    return tuning_cache_path;
+}
+
+// Binary cache (generated from cache.json at build time) is used for the default cache and for explicitly given *.bin files.
+std::shared_ptr<kernel_selector::OfflineTuningCache> get_binary_cache_from_file(uint32_t compute_units_count, const gpu_toolkit& context) {
+    const std::string json_ext = ".json";
+    const std::string bin_ext = ".bin";
+    std::string tuning_cache_path = get_tuning_cache_path(context);
+
+    auto ends_with = [](const std::string& str, const std::string& suffix)
+    {
+        return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+
+    if (context.get_configuration().tuning_cache_path.compare("cache.json") == 0 && ends_with(tuning_cache_path, json_ext))
+        tuning_cache_path.replace(tuning_cache_path.size() - json_ext.size(), json_ext.size(), bin_ext);
+    else if (!ends_with(tuning_cache_path, bin_ext))
+        return nullptr;
+
+    return kernel_selector::OfflineTuningCache::Open(tuning_cache_path, compute_units_count);
+}
+
+std::shared_ptr<rapidjson::Document> get_cache_from_file(uint32_t compute_units_count, const gpu_toolkit& context) {
+    std::string tuning_cache_path = get_tuning_cache_path(context);
     rapidjson::Document cacheFile;
     rapidjson::Document cacheDeviceData;
     auto computeUnits = std::to_string(compute_units_count);
@@ -195,11 +219,21 @@ engine_info_internal::engine_info_internal(const gpu_toolkit& context)
     driver_version = context.device().getInfo<CL_DRIVER_VERSION>();
 
     compute_units_count = context.device().getInfo<CL_DEVICE_MAX_COMPUTE_UNITS>();
+    device_binary_cache = get_binary_cache_from_file(compute_units_count, context);
     try {
-        device_cache = get_cache_from_file(compute_units_count, context);
+        if (device_binary_cache)
+        {
+            device_cache = std::make_shared<rapidjson::Document>();
+            device_cache->Parse("{}");
+        }
+        else
+        {
+            device_cache = get_cache_from_file(compute_units_count, context);
+        }
     }
     catch (...){
         std::cout << "[WARNING] error during parsing cache file, tuning data won't be used" << std::endl;
+        device_cache = std::make_shared<rapidjson::Document>();
         device_cache->Parse("{}");
     }
     cores_count = static_cast<uint32_t>(context.device().getInfo<CL_DEVICE_MAX_COMPUTE_UNITS>());
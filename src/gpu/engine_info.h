@@ -18,6 +18,7 @@
 #include <memory>
 #include "api/CPP/engine.hpp"
 #include "document.h"
+#include "offline_tuning_cache.h"
 
 
 namespace cldnn {
@@ -30,6 +31,7 @@ struct engine_info_internal : cldnn::engine_info
     std::string driver_version;
     std::uint32_t compute_units_count;
     std::shared_ptr<rapidjson::Document> device_cache; 
+    std::shared_ptr<kernel_selector::OfflineTuningCache> device_binary_cache;
 
 private:
     friend class gpu_toolkit;
@@ -15,125 +15,256 @@
 */
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
 #include "refcounted_obj.h"
 #include "event_impl.h"
 #include "meta_utils.h"
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
 
 namespace cldnn {
     namespace gpu {
 
         class gpu_toolkit;
 
+        // Events are kept in slots which are never moved or freed while the pool exists, so slots can be addressed
+        // by index from many threads. Free and used slots are linked into lock-free stacks: acquiring an event pops
+        // a free slot (or allocates a new one) and pushes it to the used stack of its owner, reset_events moves all used
+        // slots of one owner back to the free stack. Stack heads are (tag, index) pairs - the tag is bumped on every change
+        // to avoid ABA between concurrent pops.
         template<typename Type,
             typename U = typename std::enable_if<
             meta::is_any_of<Type, base_event, user_event, base_events>::value>::type>
         class event_pool_impl
         {
         protected:
-            event_pool_impl() = default;
+            event_pool_impl()
+                : _free(make_head(0, invalid_index))
+                , _size(0)
+            {
+                for (auto& chunk : _chunks)
+                    chunk.store(nullptr, std::memory_order_relaxed);
+            }
+
+            ~event_pool_impl()
+            {
+                for (auto& chunk : _chunks)
+                    delete[] chunk.load(std::memory_order_relaxed);
+            }
+
+            event_pool_impl(const event_pool_impl&) = delete;
+            event_pool_impl& operator=(const event_pool_impl&) = delete;
 
             using type = Type;
 
-            event_impl::ptr get_from_pool(std::shared_ptr<gpu_toolkit>& ctx)
-            {   
-                for (auto& ev : _events)
+        public:
+            // stack of used slots of one owner
+            class used_list
+            {
+            public:
+                used_list() : _head(make_head(0, invalid_index)) {}
+            private:
+                friend class event_pool_impl;
+                std::atomic<uint64_t> _head;
+            };
+
+        protected:
+            event_impl::ptr get_from_pool(std::shared_ptr<gpu_toolkit>& ctx, used_list& used)
+            {
+                auto idx = pop(_free);
+                if (idx == invalid_index)
+                    idx = allocate({ new Type(ctx), false });
+
+                push(used._head, idx);
+                return get_slot(idx).event;
+            }
+
+            void reset_events(used_list& used)
+            {
+                // used stack is only pushed to concurrently, so it can be detached as a whole without ABA concerns
+                auto head = used._head.exchange(make_head(0, invalid_index), std::memory_order_acq_rel);
+                auto idx = index_of(head);
+                while (idx != invalid_index)
                 {
-                    if (!ev->is_valid())
-                        return ev;
+                    auto& slot = get_slot(idx);
+                    auto next = slot.next.load(std::memory_order_relaxed);
+                    slot.event->reset();
+                    push(_free, idx);
+                    idx = next;
                 }
-                return allocate({ new Type(ctx), false });
             }
 
-            void reset_events()
+        public:
+            // number of events allocated by the pool
+            size_t size() const { return _size.load(std::memory_order_relaxed); }
+
+        private:
+            static constexpr uint32_t invalid_index = UINT32_MAX;
+            static constexpr uint32_t chunk_size = 256;
+            static constexpr uint32_t max_chunks = 4096;
+
+            struct slot
             {
-                for (auto& ev : _events)
-                    ev->reset();
+                event_impl::ptr event;
+                std::atomic<uint32_t> next{ invalid_index };
+            };
+
+            std::atomic<uint64_t> _free;
+            std::atomic<uint32_t> _size;
+            std::atomic<slot*> _chunks[max_chunks];
+
+            static uint64_t make_head(uint32_t tag, uint32_t index) { return (static_cast<uint64_t>(tag) << 32) | index; }
+            static uint32_t tag_of(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+            static uint32_t index_of(uint64_t head) { return static_cast<uint32_t>(head); }
+
+            slot& get_slot(uint32_t idx) const
+            {
+                return _chunks[idx / chunk_size].load(std::memory_order_acquire)[idx % chunk_size];
             }
 
-        private:
-            std::vector<event_impl::ptr> _events;
+            uint32_t allocate(const event_impl::ptr& obj)
+            {
+                auto idx = _size.fetch_add(1, std::memory_order_relaxed);
+                if (idx >= chunk_size * max_chunks)
+                    throw std::runtime_error("events pool exhausted");
+
+                auto& chunk = _chunks[idx / chunk_size];
+                auto slots = chunk.load(std::memory_order_acquire);
+                if (!slots)
+                {
+                    auto new_slots = new slot[chunk_size];
+                    if (chunk.compare_exchange_strong(slots, new_slots, std::memory_order_acq_rel))
+                        slots = new_slots;
+                    else
+                        delete[] new_slots;
+                }
+                slots[idx % chunk_size].event = obj;
+                return idx;
+            }
 
-            event_impl::ptr allocate(const event_impl::ptr& obj)
+            void push(std::atomic<uint64_t>& stack, uint32_t idx)
             {
-                _events.emplace_back(obj);
-                return _events.back();
+                auto& slot = get_slot(idx);
+                auto head = stack.load(std::memory_order_relaxed);
+                do
+                {
+                    slot.next.store(index_of(head), std::memory_order_relaxed);
+                } while (!stack.compare_exchange_weak(head, make_head(tag_of(head) + 1, idx), std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            uint32_t pop(std::atomic<uint64_t>& stack)
+            {
+                auto head = stack.load(std::memory_order_acquire);
+                while (index_of(head) != invalid_index)
+                {
+                    auto next = get_slot(index_of(head)).next.load(std::memory_order_relaxed);
+                    if (stack.compare_exchange_weak(head, make_head(tag_of(head) + 1, next), std::memory_order_acquire, std::memory_order_acquire))
+                        return index_of(head);
+                }
+                return invalid_index;
             }
         };
 
         struct base_event_pool : event_pool_impl<base_event>
         {
-            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, const cl::Event& ev, const uint64_t q_stamp)
+            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, const cl::Event& ev, const uint64_t q_stamp, const uint16_t queue_id, used_list& used)
             {
-                auto ret = get_from_pool(ctx);
-                dynamic_cast<type*>(ret.get())->attach_ocl_event(ev, q_stamp);
+                auto ret = get_from_pool(ctx, used);
+                dynamic_cast<type*>(ret.get())->attach_ocl_event(ev, q_stamp, queue_id);
                 return ret;
             }
-            void reset()
+            void reset(used_list& used)
             {
-                reset_events();
+                reset_events(used);
             }
         };
 
         struct user_event_pool : event_pool_impl<user_event>
         {
-            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, bool set = false)
+            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, bool set, used_list& used)
             {
-                auto ret = get_from_pool(ctx);
+                auto ret = get_from_pool(ctx, used);
                 dynamic_cast<type*>(ret.get())->attach_event(set);
                 return ret;
             }
-            void reset()
+            void reset(used_list& used)
             {
-                reset_events();
+                reset_events(used);
             }
         };
 
         struct group_event_pool : event_pool_impl<base_events>
         {
-            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, const std::vector<event_impl::ptr>& deps)
+            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, const std::vector<event_impl::ptr>& deps, used_list& used)
             {
-                auto ret_ev = get_from_pool(ctx);
+                auto ret_ev = get_from_pool(ctx, used);
                 dynamic_cast<type*>(ret_ev.get())->attach_events(deps);
                 return ret_ev;
             }
-            void reset()
+            void reset(used_list& used)
             {
-                reset_events();
+                reset_events(used);
             }
         };
 
+        // events acquired for one execution of a network - they are reset together, independently of events
+        // of other networks, which may be executed at the same time
+        class events_owner
+        {
+            friend class events_pool;
+            base_event_pool::used_list _base;
+            user_event_pool::used_list _user;
+            group_event_pool::used_list _group;
+        };
+
+        // events acquired without an owner (nullptr) are reset only by reset_events()
         class events_pool
         {
         public:
             events_pool() = default;
 
-            event_impl::ptr get_from_base_pool(std::shared_ptr<gpu_toolkit> ctx, const cl::Event& ev, const uint64_t q_stamp)
+            event_impl::ptr get_from_base_pool(std::shared_ptr<gpu_toolkit> ctx, const cl::Event& ev, const uint64_t q_stamp, const uint16_t queue_id, events_owner* owner = nullptr)
             {
-                return _base_pool.get(ctx, ev, q_stamp);
+                return _base_pool.get(ctx, ev, q_stamp, queue_id, get_owner(owner)._base);
             }
            
-            event_impl::ptr get_from_user_pool(std::shared_ptr<gpu_toolkit> ctx, bool set = false)
+            event_impl::ptr get_from_user_pool(std::shared_ptr<gpu_toolkit> ctx, bool set = false, events_owner* owner = nullptr)
             {
-                return _user_pool.get(ctx, set);
+                return _user_pool.get(ctx, set, get_owner(owner)._user);
             }
 
-            event_impl::ptr get_from_group_pool(std::shared_ptr<gpu_toolkit> ctx, const std::vector<event_impl::ptr>& deps)
+            event_impl::ptr get_from_group_pool(std::shared_ptr<gpu_toolkit> ctx, const std::vector<event_impl::ptr>& deps, events_owner* owner = nullptr)
             {
-                return _group_pool.get(ctx, deps);
+                return _group_pool.get(ctx, deps, get_owner(owner)._group);
+            }
+
+            size_t size() const
+            {
+                return _base_pool.size() + _user_pool.size() + _group_pool.size();
+            }
+
+            void reset_events(events_owner& owner)
+            {
+                _base_pool.reset(owner._base);
+                _user_pool.reset(owner._user);
+                _group_pool.reset(owner._group);
             }
 
             void reset_events()
             {
-                _base_pool.reset();
-                _user_pool.reset();
-                _group_pool.reset();
+                reset_events(_no_owner);
             }
 
         private:
             base_event_pool _base_pool;
             user_event_pool _user_pool;
             group_event_pool _group_pool;
+            events_owner _no_owner;
+
+            events_owner& get_owner(events_owner* owner) { return owner ? *owner : _no_owner; }
         };
     }
 }
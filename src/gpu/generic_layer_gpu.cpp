@@ -16,6 +16,7 @@
 
 #include "generic_layer_inst.h"
 #include "kernel.h"
+#include "primitive_gpu_base.h"
 #include "implementation_map.h"
 #include "kernel_selector_helper.h"
 #include "network_impl.h"
@@ -62,23 +63,15 @@ struct generic_layer_cpu : typed_primitive_impl<generic_layer>
 
     event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, generic_layer_inst& instance) override
     {
-        auto& input_mem = instance.input_memory();
-        auto& output_mem = instance.output_memory();
-
-        std::vector<event_impl::ptr> tmp_events(events);
-
-        for (auto& a : events) {
-            a->wait();
-        }
-
-        mem_lock<uint8_t> old_pointer(input_mem);
-        mem_lock<uint8_t> new_pointer(output_mem);
-
-        const auto& cpu_kernel = *outer.get_primitive()->get_generic_params().cpuKernel.get();
+        return cldnn::gpu::run_host_task(instance, events, [this, &instance]()
+        {
+            mem_lock<uint8_t> old_pointer(instance.input_memory());
+            mem_lock<uint8_t> new_pointer(instance.output_memory());
 
-        cpu_kernel.Execute(old_pointer.data(), old_pointer.size(), new_pointer.data(), new_pointer.size());
+            const auto& cpu_kernel = *outer.get_primitive()->get_generic_params().cpuKernel.get();
 
-        return instance.get_network().get_engine().create_user_event(true);
+            cpu_kernel.Execute(old_pointer.data(), old_pointer.size(), new_pointer.data(), new_pointer.size());
+        });
     }
 };
 
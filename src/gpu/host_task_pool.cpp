@@ -0,0 +1,93 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "host_task_pool.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace gpu {
+
+host_task_pool::host_task_pool(size_t n_threads)
+    : _state(std::make_shared<state>())
+{
+    for (size_t i = 0; i < std::max<size_t>(n_threads, 1); i++)
+        _threads.emplace_back(&host_task_pool::worker, _state);
+}
+
+host_task_pool::~host_task_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->stop = true;
+    }
+    _state->cv.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        if (thread.get_id() == std::this_thread::get_id())
+            thread.detach();
+        else
+            thread.join();
+    }
+}
+
+void host_task_pool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->tasks.push_back(std::move(task));
+    }
+    _state->cv.notify_one();
+}
+
+void host_task_pool::set_error(std::exception_ptr error)
+{
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    if (!_state->error)
+        _state->error = error;
+}
+
+void host_task_pool::rethrow_error()
+{
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        std::swap(error, _state->error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void host_task_pool::worker(std::shared_ptr<state> state)
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->cv.wait(lock, [&state] { return state->stop || !state->tasks.empty(); });
+            // pending tasks are finished before stopping, they set events other threads may wait for
+            if (state->tasks.empty())
+                return;
+            task = std::move(state->tasks.front());
+            state->tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} }
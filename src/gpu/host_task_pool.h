@@ -0,0 +1,65 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cldnn { namespace gpu {
+
+// Worker threads running host code of primitives (see run_host_task). Tasks are submitted from OpenCL event callbacks,
+// so submit never blocks. An exception thrown by a task is kept and rethrown by the next rethrow_error call.
+class host_task_pool
+{
+public:
+    explicit host_task_pool(size_t n_threads);
+    ~host_task_pool();
+
+    host_task_pool(const host_task_pool&) = delete;
+    host_task_pool& operator=(const host_task_pool&) = delete;
+
+    void submit(std::function<void()> task);
+    void set_error(std::exception_ptr error);
+    void rethrow_error();
+
+private:
+    // shared with the workers, so a worker which destroys the pool (by releasing the last reference to the engine
+    // from a task) can be detached safely
+    struct state
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<std::function<void()>> tasks;
+        std::exception_ptr error;
+        bool stop = false;
+    };
+
+    static void worker(std::shared_ptr<state> state);
+
+    std::shared_ptr<state> _state;
+    std::vector<std::thread> _threads;
+};
+
+} }
@@ -38,188 +38,182 @@ namespace {
         }
     }
 
-    void set_arguments(
-        cl::Kernel& kernel,
-        const kernel_selector::kernel_arguments& args,
+    // returns memory object passed as given kernel argument or nullptr if the argument doesn't refer to memory
+    const memory_impl* get_memory_argument(
+        const kernel_selector::kernel_argument_element& arg,
         const kernel::kernel_arguments_data& data)
     {
-        for (uint32_t i = 0; i < static_cast<uint32_t>(args.size()); i++)
+        switch (arg.t)
+        {
+        case kernel_selector::kernel_argument_types::INPUT:
+            return arg.index < data.inputs.size() ? data.inputs[arg.index].get() : nullptr;
+        case kernel_selector::kernel_argument_types::INTERNAL_BUFFER:
+            return arg.index < data.intermediates.size() ? data.intermediates[arg.index].get() : nullptr;
+        case kernel_selector::kernel_argument_types::OUTPUT:
+            return data.output.get();
+        case kernel_selector::kernel_argument_types::WEIGHTS:
+            return data.weights.get();
+        case kernel_selector::kernel_argument_types::BIAS:
+            return data.bias.get();
+        case kernel_selector::kernel_argument_types::PREV_WEIGHTS_GRADIENT:
+            return data.prev_weights_grad.get();
+        case kernel_selector::kernel_argument_types::PREV_BIAS_GRADIENT:
+            return data.prev_bias_grad.get();
+        case kernel_selector::kernel_argument_types::WEIGHTS_QUANTIZATION_FACTORS:
+            return data.weights_quantization_factors.get();
+        case kernel_selector::kernel_argument_types::OUTPUT_CALIBRATION_FACTORS:
+            if (arg.index == 0)
+                return data.output_calibration_factors.get();
+            return arg.index - 1 < data.fused_op_calibration_factors.size() ? data.fused_op_calibration_factors[arg.index - 1].get() : nullptr;
+        case kernel_selector::kernel_argument_types::SCALE_TABLE:
+            return data.scale_table.get();
+        case kernel_selector::kernel_argument_types::SLOPE:
+            return data.slope.get();
+        case kernel_selector::kernel_argument_types::RECURRENT: // RNN/LSTM/GRU layers
+            return data.recurrent.get();
+        case kernel_selector::kernel_argument_types::HIDDEN: // RNN/LSTM/GRU layers
+            return data.hidden.get();
+        case kernel_selector::kernel_argument_types::CELL: // LSTMlayers
+            return data.cell.get();
+        default:
+            return nullptr;
+        }
+    }
+
+    bool is_memory_argument(const kernel_selector::kernel_argument_element& arg)
+    {
+        switch (arg.t)
         {
-            cl_int status = CL_INVALID_ARG_VALUE;
+        case kernel_selector::kernel_argument_types::SPLIT:
+        case kernel_selector::kernel_argument_types::LEARNING_RATE:
+        case kernel_selector::kernel_argument_types::SCALAR:
+            return false;
+        default:
+            return true;
+        }
+    }
 
-            switch (args[i].t)
+    cl_mem get_cl_memory(const memory_impl& mem)
+    {
+        if (mem.get_layout().format.is_image_2d())
+            return dynamic_cast<const gpu::gpu_image2d&>(mem).get_buffer()();
+        return dynamic_cast<const gpu::gpu_buffer&>(mem).get_buffer()();
+    }
+
+    cl_int set_scalar_argument(cl::Kernel& kernel, uint32_t i, const kernel_selector::kernel_argument_element& arg, const kernel::kernel_arguments_data& data)
+    {
+        cl_int status = CL_INVALID_ARG_VALUE;
+
+        switch (arg.t)
+        {
+        case kernel_selector::kernel_argument_types::SPLIT:
+            status = kernel.setArg(i, data.split);
+            break;
+        case kernel_selector::kernel_argument_types::LEARNING_RATE:
+            status = kernel.setArg(i, data.lr);
+            break;
+        case kernel_selector::kernel_argument_types::SCALAR:
+            if (data.scalars && arg.index < data.scalars->size())
             {
-            case kernel_selector::kernel_argument_types::INPUT:
-                if (args[i].index < data.inputs.size() && data.inputs[args[i].index])
-                {
-                    const auto& input_mem = data.inputs[args[i].index];
-                    if (input_mem)
-                    {
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
-                    }
-                }
-                break;
-            case kernel_selector::kernel_argument_types::INTERNAL_BUFFER:
-                if (args[i].index < data.intermediates.size() && data.intermediates[args[i].index])
-                {
-                    const auto& input_mem = data.intermediates[args[i].index];
-                    if (input_mem)
-                    {
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
-                    }
-                }
-                break;
-            case kernel_selector::kernel_argument_types::OUTPUT:
-                if (data.output)
-                {
-                    if (data.output->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.output).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.output).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::WEIGHTS:
-                if (data.weights)
-                {
-                    if (data.weights->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.weights).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.weights).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::BIAS:
-                if (data.bias)
-                {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.bias).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::PREV_WEIGHTS_GRADIENT:
-                if (data.prev_weights_grad)
-                {
-                    if (data.prev_weights_grad->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.prev_weights_grad).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.prev_weights_grad).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::PREV_BIAS_GRADIENT:
-                if (data.prev_bias_grad)
-                {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.prev_bias_grad).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::WEIGHTS_QUANTIZATION_FACTORS:
-                if (data.weights_quantization_factors)
-                {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.weights_quantization_factors).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::OUTPUT_CALIBRATION_FACTORS:
-                if (args[i].index == 0)
-                {
-                    if (data.output_calibration_factors)
-                    {
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.output_calibration_factors).get_buffer());
-                    }
-                }
-                else
-                {
-                    size_t new_idx = args[i].index - 1;
-                    if (new_idx < data.fused_op_calibration_factors.size() && data.fused_op_calibration_factors[new_idx])
-                    {
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.fused_op_calibration_factors[new_idx]).get_buffer());
-                    }
+                const auto& scalar = (*data.scalars)[arg.index];
+                switch (scalar.t)
+                {
+                case kernel_selector::kernel_scalar_argument_types::UINT8:
+                    status = kernel.setArg(i, scalar.v.u8);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::UINT16:
+                    status = kernel.setArg(i, scalar.v.u16);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::UINT32:
+                    status = kernel.setArg(i, scalar.v.u32);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::UINT64:
+                    status = kernel.setArg(i, scalar.v.u64);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::INT8:
+                    status = kernel.setArg(i, scalar.v.s8);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::INT16:
+                    status = kernel.setArg(i, scalar.v.s16);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::INT32:
+                    status = kernel.setArg(i, scalar.v.s32);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::INT64:
+                    status = kernel.setArg(i, scalar.v.s64);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::FLOAT32:
+                    status = kernel.setArg(i, scalar.v.f32);
+                    break;
+                case kernel_selector::kernel_scalar_argument_types::FLOAT64:
+                    status = kernel.setArg(i, scalar.v.f64);
+                    break;
+                default:
+                    break;
                 }
+            }
+            break;
+        default:
+            break;
+        }
 
-                break;
-            case kernel_selector::kernel_argument_types::SCALE_TABLE:
-                if (data.scale_table)
-                {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.scale_table).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::SLOPE:
-                if (data.slope)
-                {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.slope).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::SPLIT:
-                status = kernel.setArg(i, data.split);
-                break;
-            case kernel_selector::kernel_argument_types::LEARNING_RATE:
-                status = kernel.setArg(i, data.lr);
-                break;
-            case kernel_selector::kernel_argument_types::SCALAR:
-                if (data.scalars && args[i].index < data.scalars->size())
-                {
-                    const auto& scalar = (*data.scalars)[args[i].index];
-                    switch (scalar.t)
-                    {
-                    case kernel_selector::kernel_scalar_argument_types::UINT8:
-                        status = kernel.setArg(i, scalar.v.u8);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::UINT16:
-                        status = kernel.setArg(i, scalar.v.u16);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::UINT32:
-                        status = kernel.setArg(i, scalar.v.u32);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::UINT64:
-                        status = kernel.setArg(i, scalar.v.u64);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::INT8:
-                        status = kernel.setArg(i, scalar.v.s8);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::INT16:
-                        status = kernel.setArg(i, scalar.v.s16);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::INT32:
-                        status = kernel.setArg(i, scalar.v.s32);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::INT64:
-                        status = kernel.setArg(i, scalar.v.s64);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::FLOAT32:
-                        status = kernel.setArg(i, scalar.v.f32);
-                        break;
-                    case kernel_selector::kernel_scalar_argument_types::FLOAT64:
-                        status = kernel.setArg(i, scalar.v.f64);
-                        break;
-                    default:
-                        break;
-                    }
-                }
-                break;
-            case kernel_selector::kernel_argument_types::RECURRENT: // RNN/LSTM/GRU layers
-                if (data.recurrent)
-                {
-                    if (data.recurrent->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.recurrent).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.recurrent).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::HIDDEN: // RNN/LSTM/GRU layers
-                if (data.hidden)
-                {
-                    if (data.hidden->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.hidden).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.hidden).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::CELL: // LSTMlayers
-                if (data.cell)
+        return status;
+    }
+}
+
+kernel::bound_kernel& kernel::get_bound_kernel(int32_t split) const
+{
+    if (static_cast<size_t>(split) >= _bound_kernels.size())
+        _bound_kernels.resize(split + 1);
+
+    auto& bound = _bound_kernels[split];
+    if (!bound.kernel())
+    {
+        auto clkernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+        try {
+            // one time kernels are not shared, so there is no need for a private copy
+            if (_one_time_kernel)
+                bound.kernel = clkernel;
+            else
+                bound.kernel = cl::Kernel(clkernel.getInfo<CL_KERNEL_PROGRAM>(), clkernel.getInfo<CL_KERNEL_FUNCTION_NAME>().c_str());
+        }
+        catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+    }
+    return bound;
+}
+
+void kernel::set_arguments(
+    const kernel_selector::cl_kernel_data& kernel_data,
+    const kernel_arguments_data& data) const
+{
+    auto& bound = get_bound_kernel(data.split);
+    const auto& args = kernel_data.arguments;
+    bound.memory_args.resize(args.size(), nullptr);
+
+    try {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(args.size()); i++)
+        {
+            cl_int status = CL_SUCCESS;
+
+            if (is_memory_argument(args[i]))
+            {
+                auto mem = get_memory_argument(args[i], data);
+                if (!mem)
+                    throw std::runtime_error("Error set args\n");
+
+                auto cl_mem_obj = get_cl_memory(*mem);
+                if (cl_mem_obj != bound.memory_args[i])
                 {
-                    if (data.cell->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.cell).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.cell).get_buffer());
+                    status = clSetKernelArg(bound.kernel(), i, sizeof(cl_mem), &cl_mem_obj);
+                    bound.memory_args[i] = status == CL_SUCCESS ? cl_mem_obj : nullptr;
                 }
-                break;
-            default:
-                break;
+            }
+            // split and scalars don't change between executions, learning rate can be changed by the user at any time
+            else if (!bound.scalars_bound || args[i].t == kernel_selector::kernel_argument_types::LEARNING_RATE)
+            {
+                status = set_scalar_argument(bound.kernel, i, args[i], data);
             }
 
             if (status != CL_SUCCESS)
@@ -227,23 +221,20 @@ namespace {
                 throw std::runtime_error("Error set args\n");
             }
         }
+        bound.scalars_bound = true;
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
     }
 }
 
 event_impl::ptr kernel::run(
     const kernel_selector::cl_kernel_data& kernel_data,
     const std::vector<event_impl::ptr>& dependencies,
-    const kernel_arguments_data& args) const
+    int32_t split) const
 {
-    auto clkernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
-    try {
-        set_arguments(clkernel, kernel_data.arguments, args);
-    }
-    catch (cl::Error const& err) {
-        throw ocl_error(err);
-    }
-
-    return context()->enqueue_kernel(clkernel, toNDRange(kernel_data.workGroups.global), toNDRange(kernel_data.workGroups.local), dependencies);
+    auto& bound = get_bound_kernel(split);
+    return context()->enqueue_kernel(bound.kernel, toNDRange(kernel_data.workGroups.global), toNDRange(kernel_data.workGroups.local), dependencies);
 }
 
 } }
\ No newline at end of file
@@ -28,8 +28,21 @@ namespace cldnn { namespace gpu {
 
 class kernel : public context_holder 
 {
+    // Kernel object owned by this instance together with values of arguments which are currently set on it.
+    // Kernels from the cache are shared between primitives with the same source, so every gpu::kernel (and every split
+    // executed by it) works on a private copy to keep its arguments bound between executions.
+    struct bound_kernel
+    {
+        cl::Kernel kernel;
+        std::vector<cl_mem> memory_args;
+        bool scalars_bound = false;
+    };
+
     kernels_cache::kernel_id _kernel_id;
     bool _one_time_kernel; //If this flag is true, the kernel is intended to be executed only once (can be removed later from the cache).
+    mutable std::vector<bound_kernel> _bound_kernels;
+
+    bound_kernel& get_bound_kernel(int32_t split) const;
 
 public:
     explicit kernel(std::shared_ptr<gpu_toolkit> context, const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program = false, bool one_time_kernel = false)
@@ -49,6 +62,7 @@ public:
 
         _kernel_id = other._kernel_id;
         _one_time_kernel = other._one_time_kernel;
+        _bound_kernels.clear();
 
         return *this;
     }
@@ -79,10 +93,26 @@ public:
 
     void set_output_event(bool is_out_event) { context()->set_output_event(is_out_event); }
 
+    // Sets arguments for the kernel instance used for args.split. Only the arguments which differ from the ones
+    // bound by the previous call are passed to OpenCL.
+    void set_arguments(
+        const kernel_selector::cl_kernel_data& kernel_data,
+        const kernel_arguments_data& args) const;
+
+    // Enqueues the kernel instance used for given split with arguments bound by the last set_arguments call.
     event_impl::ptr run(
         const kernel_selector::cl_kernel_data& kernel_data,
         const std::vector<event_impl::ptr>& dependencies,
-        const kernel_arguments_data& args) const;
+        int32_t split = 0) const;
+
+    event_impl::ptr run(
+        const kernel_selector::cl_kernel_data& kernel_data,
+        const std::vector<event_impl::ptr>& dependencies,
+        const kernel_arguments_data& args) const
+    {
+        set_arguments(kernel_data, args);
+        return run(kernel_data, dependencies, args.split);
+    }
 };
 
 } }
@@ -19,7 +19,10 @@
 #include "kernel_runner.h"
 #include "kernel.h"
 #include "weight_bias_params.h"
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <limits>
 
 namespace cldnn { namespace gpu {
 
@@ -29,9 +32,9 @@ kernel_runner::kernel_runner(engine_impl& engine_ref, bool weights_and_bias_exis
 {
 }
 
-void kernel_runner::prepare_kernel_args(const kernel_selector::KernelsData& kernels_data, gpu::kernel::kernel_arguments_data& args)
+void kernel_runner::prepare_kernel_args(const kernel_selector::KernelData& kernel_data, gpu::kernel::kernel_arguments_data& args)
 {
-    const auto& base_params = *static_cast<kernel_selector::base_params*>(kernels_data[0].params.get());
+    const auto& base_params = *static_cast<kernel_selector::base_params*>(kernel_data.params.get());
     // Prepare input buffers
     if (input_buffers.empty())
     {
@@ -58,7 +61,7 @@ void kernel_runner::prepare_kernel_args(const kernel_selector::KernelsData& kern
     if (weights_and_bias_exist)
     {
         // Prepare weight buffer
-        const auto& weights_bias_params = *static_cast<kernel_selector::weight_bias_params*>(kernels_data[0].params.get());
+        const auto& weights_bias_params = *static_cast<kernel_selector::weight_bias_params*>(kernel_data.params.get());
         int num_of_weight_elements_ifm = static_cast<int>(weights_bias_params.weights.IFM().v);
         int num_of_weight_elements_spatial_y = static_cast<int>(weights_bias_params.weights.Y().v);
         int num_of_weight_elements_spatial_x = static_cast<int>(weights_bias_params.weights.X().v);
@@ -109,88 +112,100 @@ void kernel_runner::prepare_kernel_args(const kernel_selector::KernelsData& kern
     args.split = 0;
 }
 
+kernel& kernel_runner::get_kernel(const kernel_selector::KernelData& kernel_data)
+{
+    const auto& kernel_string = kernel_data.kernels[0].kernelString;
+    auto it = compiled_kernels.find(kernel_string->entry_point);
+    if (it == compiled_kernels.end())
+    {
+        it = compiled_kernels.emplace(kernel_string->entry_point, kernel(engine->get_context(), kernel_string, false, true)).first;
+    }
+    return it->second;
+}
+
 std::vector<uint64_t> kernel_runner::run_kernels(const kernel_selector::KernelsData& kernels_data)
 {
-    auto context = engine->get_context();
+    auto samples = run_kernels_samples(kernels_data, 0, runs_per_kernel);
 
     std::vector<uint64_t> run_times;
+    for (const auto& kernel_samples : samples)
+    {
+        if (kernel_samples.empty())
+        {
+            run_times.push_back(std::numeric_limits<uint64_t>::max());
+        }
+        else
+        {
+            uint64_t kernel_run_time = 0;
+            for (auto sample : kernel_samples)
+                kernel_run_time += sample;
+            run_times.push_back(kernel_run_time / kernel_samples.size());
+        }
+    }
 
-    int num_of_kernels_to_run = (int)kernels_data.size();
+    return run_times;
+}
 
-    kernel_selector::KernelsData::const_iterator batch_start = kernels_data.begin();
-    kernel_selector::KernelsData::const_iterator batch_end;
-    while (num_of_kernels_to_run > 0)
-    {
-        int current_compilation_batch = std::min(num_of_kernels_to_run, compilation_batch_size);
-        batch_end = batch_start + current_compilation_batch;
+std::vector<std::vector<uint64_t>> kernel_runner::run_kernels_samples(const kernel_selector::KernelsData& kernels_data, int warmup_runs, int timed_runs)
+{
+    auto context = engine->get_context();
 
-        std::vector<gpu::kernel> kernels;
+    std::vector<std::vector<uint64_t>> samples(kernels_data.size());
 
-        for (auto it = batch_start; it < batch_end; it++)
+    for (size_t batch_start = 0; batch_start < kernels_data.size(); batch_start += compilation_batch_size)
+    {
+        const size_t batch_end = std::min(kernels_data.size(), batch_start + compilation_batch_size);
+
+        // sources of the whole batch are registered before the first run, so they are compiled together
+        std::vector<kernel*> kernels;
+        for (size_t i = batch_start; i < batch_end; i++)
         {
-            kernels.push_back(kernel(context, it->kernels[0].kernelString, false, true));
+            kernels.push_back(&get_kernel(kernels_data[i]));
         }
 
-        gpu::kernel::kernel_arguments_data args;
-
-        prepare_kernel_args(kernels_data, args);
-
-        int i = 0;
-        for (auto it = batch_start; it < batch_end; it++)
+        // all runs of the batch are enqueued at once and profiled after a single synchronization
+        std::vector<std::vector<event_impl::ptr>> events(batch_end - batch_start);
+        for (size_t i = batch_start; i < batch_end; i++)
         {
-            std::vector<event_impl::ptr> events;
-            uint64_t kernel_run_time = 0;
-            int num_of_runs = 0;
+            gpu::kernel::kernel_arguments_data args;
+            prepare_kernel_args(kernels_data[i], args);
 
-            for (int iteration = 0; iteration < runs_per_kernel; iteration++)
+            auto& kernel_events = events[i - batch_start];
+            try
             {
-                event_impl::ptr event;
-                try
+                for (int iteration = 0; iteration < warmup_runs + timed_runs; iteration++)
                 {
-                    event = kernels[i].run(it->kernels[0], {}, args);
+                    auto event = kernels[i - batch_start]->run(kernels_data[i].kernels[0], {}, args);
+                    if (iteration >= warmup_runs)
+                        kernel_events.push_back(event);
                 }
-                catch (...)
-                {
-                    // Could not run this kernel. Push back NULL event (will be ignored later).
-                }
-                events.push_back(event);
             }
-                
-            context->queue().finish();
+            catch (...)
+            {
+                // Could not run this kernel. Its runs are ignored.
+                kernel_events.clear();
+            }
+        }
 
-            for (auto& event : events)
+        context->queue().finish();
+
+        for (size_t i = batch_start; i < batch_end; i++)
+        {
+            for (auto& event : events[i - batch_start])
             {
-                if (event.get() != NULL)
+                for (auto const& profiling_interval : event->get_profiling_info())
                 {
-                    auto profiling_intervals = event->get_profiling_info();
-                    for (auto const& profiling_interval : profiling_intervals)
+                    if (strcmp(profiling_interval.name, "executing") == 0)
                     {
-                        if (strcmp(profiling_interval.name, "executing") == 0)
-                        {
-                            kernel_run_time += profiling_interval.nanoseconds;
-                            num_of_runs++;
-                            break;
-                        }
+                        samples[i].push_back(profiling_interval.nanoseconds);
+                        break;
                     }
                 }
             }
-
-            if (num_of_runs > 0)
-            {
-                run_times.push_back(kernel_run_time / num_of_runs);
-            }
-            else
-            {
-                run_times.push_back(std::numeric_limits<uint64_t>::max());
-            }
-            i++;
         }
-
-        num_of_kernels_to_run -= current_compilation_batch;
-        batch_start += current_compilation_batch;
     }
 
-    return run_times;
+    return samples;
 }
 
 }}
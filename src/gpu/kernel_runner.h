@@ -22,6 +22,8 @@
 #include "kernel_runner_interface.h"
 #include "kernel.h"
 
+#include <map>
+
 namespace cldnn { namespace gpu {
 
 class kernel_runner : public kernel_selector::KernelRunnerInterface
@@ -31,15 +33,19 @@ public:
     kernel_runner(engine_impl& engine_ref, bool weights_and_bias_exist = false);
 
     std::vector<uint64_t> run_kernels(const kernel_selector::KernelsData& kernelsData) override;
+    std::vector<std::vector<uint64_t>> run_kernels_samples(const kernel_selector::KernelsData& kernelsData, int warmup_runs, int timed_runs) override;
 
 private:
 
     const int compilation_batch_size = 50;
     const int runs_per_kernel = 3;
 
-    void prepare_kernel_args(const kernel_selector::KernelsData& kernels_data, gpu::kernel::kernel_arguments_data& args);
+    void prepare_kernel_args(const kernel_selector::KernelData& kernel_data, gpu::kernel::kernel_arguments_data& args);
+    // Kernels are compiled once and reused when a candidate is measured again.
+    kernel& get_kernel(const kernel_selector::KernelData& kernel_data);
 
     engine_impl::ptr engine;
+    std::map<std::string, kernel> compiled_kernels; // entry point -> kernel
     bool weights_and_bias_exist;
     std::vector<memory_impl::cptr> input_buffers;
     std::vector<memory_impl::ptr> output_buffers;
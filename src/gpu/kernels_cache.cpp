@@ -22,11 +22,19 @@
 #include <sstream>
 #include <fstream>
 #include <set>
+#include <cstdio>
+#include <thread>
+#include <exception>
+#include <iomanip>
 
 #include "kernel_selector_helper.h"
 
 #define MAX_KERNELS_PER_PROGRAM 10
 
+// Bump whenever the layout of the binaries cache files or the way sources are turned into programs changes,
+// so stale cache entries are never picked up.
+#define BINARIES_CACHE_VERSION 1
+
 namespace cldnn { namespace gpu {
 
 namespace {
@@ -110,6 +118,78 @@ namespace {
             options.find("-D") == std::string::npos &&
             options.find("-I") == std::string::npos;
     }
+
+    const char binaries_cache_magic[8] = { 'C', 'L', 'D', 'N', 'N', 'B', 'I', 'N' };
+
+    // 64-bit FNV-1a
+    inline void hash_combine(uint64_t& hash, const std::string& str)
+    {
+        for (auto c : str)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        // separator, so {"ab", "c"} and {"a", "bc"} hash differently
+        hash ^= 0xFF;
+        hash *= 1099511628211ULL;
+    }
+
+    bool load_program_binary(const std::string& file_name, std::vector<unsigned char>& binary)
+    {
+        std::ifstream file(file_name, std::ios::binary);
+        if (!file.good())
+            return false;
+
+        char magic[sizeof(binaries_cache_magic)];
+        uint32_t version = 0;
+        uint64_t size = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (!file.good() ||
+            !std::equal(std::begin(magic), std::end(magic), std::begin(binaries_cache_magic)) ||
+            version != BINARIES_CACHE_VERSION ||
+            size == 0)
+            return false;
+
+        binary.resize(static_cast<size_t>(size));
+        file.read(reinterpret_cast<char*>(binary.data()), binary.size());
+        return file.gcount() == static_cast<std::streamsize>(size);
+    }
+
+    // Writes to a temporary file first and renames it afterwards, so concurrent readers never observe partially written binaries.
+    void save_program_binary(const std::string& file_name, const std::vector<unsigned char>& binary)
+    {
+        std::stringstream tmp_name;
+        tmp_name << file_name << ".tmp" << std::this_thread::get_id();
+        const auto tmp_file_name = tmp_name.str();
+
+        {
+            std::ofstream file(tmp_file_name, std::ios::binary | std::ios::trunc);
+            if (!file.good())
+                return;
+
+            const uint32_t version = BINARIES_CACHE_VERSION;
+            const uint64_t size = binary.size();
+            file.write(binaries_cache_magic, sizeof(binaries_cache_magic));
+            file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+            file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            if (!file.good())
+            {
+                file.close();
+                std::remove(tmp_file_name.c_str());
+                return;
+            }
+        }
+
+#ifdef _WIN32
+        // rename() does not replace existing files on Windows
+        std::remove(file_name.c_str());
+#endif
+        if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+            std::remove(tmp_file_name.c_str());
+    }
 }
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const 
@@ -186,6 +266,28 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
 
 kernels_cache::kernels_cache(gpu_toolkit& context): _context(context) {}
 
+std::string kernels_cache::get_binary_cache_file_name(const source_code& sources, const std::string& options) const
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    hash_combine(hash, std::to_string(BINARIES_CACHE_VERSION));
+    hash_combine(hash, _context.device().getInfo<CL_DEVICE_NAME>());
+    hash_combine(hash, _context.device().getInfo<CL_DEVICE_VERSION>());
+    hash_combine(hash, _context.get_engine_info().dev_id);
+    hash_combine(hash, _context.get_engine_info().driver_version);
+    hash_combine(hash, options);
+    for (const auto& s : sources)
+        hash_combine(hash, s);
+
+    std::string file_name = _context.get_configuration().kernels_cache_dir;
+    if (!file_name.empty() && file_name.back() != '/')
+        file_name += '/';
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(16) << hash;
+    return file_name + "clDNN_program_" + ss.str() + ".bin";
+}
+
 kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel)
 {
     kernels_cache::kernel_id id;
@@ -214,92 +316,103 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const
+void kernels_cache::build_program_part(const program_code& program_source, size_t part_idx, const std::string& dump_file_name, program_part_build_result& result) const
 {
-    static uint32_t current_file_index = 0;
-
-    bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
+    bool dump_sources = !dump_file_name.empty();
+    bool use_binaries_cache = !_context.get_configuration().kernels_cache_dir.empty();
+    const auto& sources = program_source.source[part_idx];
 
-    std::string dump_file_name = "";
-    if (dump_sources)
+    try
     {
-        dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
-        if (!dump_file_name.empty() && dump_file_name.back() != '/')
-            dump_file_name += '/';
+        auto current_dump_file_name = dump_file_name + std::to_string(part_idx) + ".cl";
+        std::ofstream dump_file;
 
-        dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
-    }
+        if (dump_sources)
+        {
+            dump_file.open(current_dump_file_name);
 
-    try
-    {
-        kernels_map kmap;
-        std::string err_log; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
+            if (dump_file.good())
+            {
+                for (auto& s : sources)
+                    dump_file << s;
+            }
+        }
 
-        uint32_t part_idx = 0;
-        for (const auto& sources : program_source.source)
+        try
         {
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            std::ofstream dump_file;
+            cl::Program program;
+            bool loaded_from_cache = false;
+            std::string cache_file_name;
 
-            if (dump_sources)
+            if (use_binaries_cache)
             {
-                dump_file.open(current_dump_file_name);
+                cache_file_name = get_binary_cache_file_name(sources, program_source.options);
 
-                if (dump_file.good())
+                std::vector<unsigned char> binary;
+                if (load_program_binary(cache_file_name, binary))
                 {
-                    for (auto& s : sources)
-                        dump_file << s;
+                    try
+                    {
+                        program = cl::Program(_context.context(), { _context.device() }, { binary });
+                        program.build({ _context.device() }, program_source.options.c_str());
+                        loaded_from_cache = true;
+                    }
+                    catch (const cl::Error&)
+                    {
+                        // binary rejected by the driver (e.g. corrupted file) - rebuild from sources and overwrite the entry
+                    }
                 }
+
+                if (loaded_from_cache)
+                    _binaries_cache_hits++;
+                else
+                    _binaries_cache_misses++;
             }
 
-            try
+            if (!loaded_from_cache)
             {
-                cl::Program program(_context.context(), sources);
+                program = cl::Program(_context.context(), sources);
                 program.build({ _context.device() }, program_source.options.c_str());
-                ///Store kernels for serialization process.
-                _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>());
-
-                if (dump_sources && dump_file.good())
-                {
-                    dump_file << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
-                        dump_file << p.second << "\n";
+            }
 
-                    dump_file << "*/\n";
-                }
+            result.binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+            if (use_binaries_cache && !loaded_from_cache && result.binaries.size() == 1)
+                save_program_binary(cache_file_name, result.binaries.front());
 
-                cl::vector<cl::Kernel> kernels;
-                program.createKernels(&kernels);
+            if (dump_sources && dump_file.good())
+            {
+                dump_file << "\n/* Build Log:\n";
+                for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
+                    dump_file << p.second << "\n";
 
-                for (auto& k : kernels)
-                {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, k);
-                }
+                dump_file << "*/\n";
             }
-            catch (const cl::BuildError& err)
-            {
-                if (dump_sources && dump_file.good())
-                    dump_file << "\n/* Build Log:\n";
 
-                for (auto& p : err.getBuildLog())
-                {
-                    if (dump_sources && dump_file.good())
-                        dump_file << p.second << "\n";
-                
-                    err_log += p.second + '\n';
-                }
+            cl::vector<cl::Kernel> kernels;
+            program.createKernels(&kernels);
 
-                if (dump_sources && dump_file.good())
-                    dump_file << "*/\n";
+            for (auto& k : kernels)
+            {
+                auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                result.kernels.emplace(kernel_name, k);
             }
-            
         }
+        catch (const cl::BuildError& err)
+        {
+            if (dump_sources && dump_file.good())
+                dump_file << "\n/* Build Log:\n";
 
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+            for (auto& p : err.getBuildLog())
+            {
+                if (dump_sources && dump_file.good())
+                    dump_file << p.second << "\n";
 
-        return kmap;
+                result.err_log += p.second + '\n';
+            }
+
+            if (dump_sources && dump_file.good())
+                dump_file << "*/\n";
+        }
     }
     catch (const cl::Error& err)
     {
@@ -325,20 +438,85 @@ void kernels_cache::build_all()
     if (!_pending_compilation)
         return;
 
+    static uint32_t current_file_index = 0;
+
     std::lock_guard<std::mutex> lock(_mutex);
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
+    // Every part of every program is an independent compilation job. Jobs are built by a pool of host threads,
+    // each job keeps its own kernels, build log and binaries, and results are merged afterwards in the order of
+    // sorted_program_code, so the outcome does not depend on the number of threads.
+    struct build_job
+    {
+        program_code* program;
+        size_t part_idx;
+        std::string dump_file_name;
+        program_part_build_result result;
+        std::exception_ptr error;
+    };
+
+    std::vector<build_job> jobs;
     for (auto& program : sorted_program_code)
     {
-        auto kernels = build_program(program.second);
+        bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program.second.dump_custom_program;
+
+        std::string dump_file_name = "";
+        if (dump_sources)
+        {
+            dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
+            if (!dump_file_name.empty() && dump_file_name.back() != '/')
+                dump_file_name += '/';
+
+            dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
+        }
+
+        for (size_t part_idx = 0; part_idx < program.second.source.size(); part_idx++)
+            jobs.push_back({ &program.second, part_idx, dump_file_name, {}, nullptr });
+    }
+
+    std::atomic<size_t> next_job{ 0 };
+    auto worker = [&]()
+    {
+        for (size_t idx = next_job++; idx < jobs.size(); idx = next_job++)
+        {
+            auto& job = jobs[idx];
+            try
+            {
+                build_program_part(*job.program, job.part_idx, job.dump_file_name, job.result);
+            }
+            catch (...)
+            {
+                job.error = std::current_exception();
+            }
+        }
+    };
+
+    const size_t n_threads = std::min<size_t>(std::max<size_t>(_context.get_configuration().n_threads, 1), jobs.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < n_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    _one_time_kernels.clear();
+    std::string err_log; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
+    for (size_t idx = 0; idx < jobs.size(); idx++)
+    {
+        auto& job = jobs[idx];
+        if (job.error)
+            std::rethrow_exception(job.error);
+
+        ///Store kernels for serialization process.
+        _context.store_binaries(job.result.binaries);
+        err_log += job.result.err_log;
 
-        for (auto& k : kernels)
+        for (auto& k : job.result.kernels)
         {
             const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time)
+            const auto& k_id = job.program->entry_point_to_id[entry_point];
+            if (job.program->one_time)
             {
                 _one_time_kernels[k_id] = k.second;
             }
@@ -347,6 +525,10 @@ void kernels_cache::build_all()
                 _kernels[k_id] = k.second;
             }
         }
+
+        bool last_part = (idx + 1 == jobs.size()) || (jobs[idx + 1].program != job.program);
+        if (last_part && !err_log.empty())
+            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
     }
 
     _kernels_code.clear();
@@ -354,4 +536,3 @@ void kernels_cache::build_all()
 }
 
 }}
- 
\ No newline at end of file
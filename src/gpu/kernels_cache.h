@@ -78,10 +78,21 @@ private:
     std::map<std::string, kernel_type> _kernels;
     std::map<std::string, kernel_type> _one_time_kernels; // These kernels are intended to be executed only once (can be removed later from the cache).
 
+    mutable std::atomic<uint32_t> _binaries_cache_hits{ 0 };
+    mutable std::atomic<uint32_t> _binaries_cache_misses{ 0 };
+
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
+    struct program_part_build_result
+    {
+        kernels_map kernels;
+        std::string err_log;
+        std::vector<std::vector<unsigned char>> binaries;
+    };
+
+    void build_program_part(const program_code& pcode, size_t part_idx, const std::string& dump_file_name, program_part_build_result& result) const;
+    std::string get_binary_cache_file_name(const source_code& sources, const std::string& options) const;
 
 public:
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel);
@@ -89,6 +100,9 @@ public:
     gpu_toolkit& get_context() { return _context; }
     //forces compilation of all pending kernels/programs
     void build_all();
+    //number of program parts loaded from / missing in the persistent binaries cache (see configuration::kernels_cache_dir)
+    uint32_t get_binaries_cache_hits() const { return _binaries_cache_hits; }
+    uint32_t get_binaries_cache_misses() const { return _binaries_cache_misses; }
 };
 
 }}
@@ -42,7 +42,7 @@ protected:
         kernel::kernel_arguments_data args = parent::get_arguments(instance, 0);
 
         args.output     = &instance.output_memory();
-        args.weights    = &instance.weights_memory();
+        args.weights    = instance.weights_term() ? &instance.weights_memory() : nullptr;
         args.recurrent  = &instance.recurrent_memory();
         args.bias       = instance.bias_term() ? &instance.bias_memory() : nullptr;
         args.hidden     = instance.hidden_term() ? &instance.hidden_memory() : nullptr;
@@ -54,11 +54,16 @@ public:
 
     static primitive_impl* create(const lstm_gemm_node& arg)
     {
-        const auto& weights_layout   = arg.weights().get_output_layout();
-
         auto lstm_gemm_params = get_default_params<kernel_selector::lstm_gemm_params>(arg);
-        lstm_gemm_params.weights = convert_data_tensor(weights_layout);
-
+        if (arg.weights_term())
+        {
+            const auto& weights_layout = arg.weights().get_output_layout();
+            lstm_gemm_params.weights = convert_data_tensor(weights_layout);
+        }
+        else
+        {
+            lstm_gemm_params.projectedInput = true;
+        }
 
         if (arg.bias_term())
         {
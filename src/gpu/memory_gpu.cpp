@@ -30,20 +30,48 @@ cl_mem_flags resource_flags_to_cl_mem_flags(resource_flags flags)
         cl_flags |= CL_MEM_READ_ONLY;
     if (resource_flags::NONE != (flags & resource_flags::COPY_HOST_PTR))
         cl_flags |= CL_MEM_COPY_HOST_PTR;
+    if (resource_flags::NONE != (flags & resource_flags::ALLOC_HOST_PTR))
+        cl_flags |= CL_MEM_ALLOC_HOST_PTR;
+    if (resource_flags::NONE != (flags & resource_flags::USE_HOST_PTR))
+        cl_flags |= CL_MEM_USE_HOST_PTR;
 
     return cl_flags;
 }
 
-gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout)
+cl_map_flags lock_mode_to_cl_map_flags(lock_mode mode)
+{
+    switch (mode)
+    {
+    case lock_mode::read:
+        return CL_MAP_READ;
+    case lock_mode::write:
+        return CL_MAP_WRITE_INVALIDATE_REGION;
+    default:
+        return CL_MAP_READ | CL_MAP_WRITE;
+    }
+}
+
+// nested locks share the mapping of the first one, so it has to allow everything they need
+void check_nested_lock(lock_mode mapped_mode, lock_mode mode)
+{
+    if (mapped_mode != lock_mode::read_write && mapped_mode != mode)
+        throw error("memory is already locked with a different access mode", CLDNN_ERROR);
+}
+
+gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout, resource_flags flags, void* host_ptr, bool reset)
     : memory_impl(engine, layout, false)
     , _context(engine->get_context())
     , _lock_count(0)
-    , _buffer(_context->context(), CL_MEM_READ_WRITE, size())
+    , _buffer(_context->context(), resource_flags_to_cl_mem_flags(flags), size(), host_ptr)
     , _mapped_ptr(nullptr)
 {
-    void* ptr = gpu_buffer::lock();
-    memset(ptr, 0, size());
-    gpu_buffer::unlock();
+    if (reset)
+    {
+        // in-order queue runs the fill before any later use of the buffer, out-of-order one doesn't order it at all
+        _context->queue().enqueueFillBuffer<unsigned char>(_buffer, 0, 0, size(), nullptr, &_fill_event);
+        if (_context->is_out_of_order())
+            _fill_event.wait();
+    }
 }
 
 gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, resource_flags flags, gpu_buffer::ptr to_copy)
@@ -66,10 +94,17 @@ gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layo
 
 }
 
-void* gpu_buffer::lock() {
+void* gpu_buffer::lock(lock_mode mode) {
     std::lock_guard<std::mutex> locker(_mutex);
-    if (0 == _lock_count) {
-        _mapped_ptr = _context->queue().enqueueMapBuffer(_buffer, CL_TRUE, CL_MAP_WRITE, 0, size());
+    if (_async_mapped) {
+        _map_event.wait();
+    }
+    else if (0 == _lock_count) {
+        _mapped_ptr = _context->queue().enqueueMapBuffer(_buffer, CL_TRUE, lock_mode_to_cl_map_flags(mode), 0, size());
+        _mapped_mode = mode;
+    }
+    else {
+        check_nested_lock(_mapped_mode, mode);
     }
     _lock_count++;
     return _mapped_ptr;
@@ -78,12 +113,55 @@ void* gpu_buffer::lock() {
 void gpu_buffer::unlock() {
     std::lock_guard<std::mutex> locker(_mutex);
     _lock_count--;
-    if (0 == _lock_count) {
+    if (0 == _lock_count && !_async_mapped) {
         _context->queue().enqueueUnmapMemObject(_buffer, _mapped_ptr);
         _mapped_ptr = nullptr;
     }
 }
 
+bool gpu_buffer::map_async(cl_map_flags flags, const std::vector<cl::Event>& deps, cl::Event& map_event) {
+    std::lock_guard<std::mutex> locker(_mutex);
+    if (0 != _lock_count || _async_mapped)
+        return false;
+
+    _mapped_ptr = _context->queue().enqueueMapBuffer(_buffer, CL_FALSE, flags, 0, size(), &deps, &_map_event);
+    _async_mapped = true;
+    map_event = _map_event;
+    return true;
+}
+
+void gpu_buffer::unmap_async(const std::vector<cl::Event>& deps, cl::Event& unmap_event) {
+    std::lock_guard<std::mutex> locker(_mutex);
+    assert(_async_mapped);
+    _context->queue().enqueueUnmapMemObject(_buffer, _mapped_ptr, &deps, &unmap_event);
+}
+
+void gpu_buffer::release_async_map() {
+    std::lock_guard<std::mutex> locker(_mutex);
+    assert(0 == _lock_count);
+    _async_mapped = false;
+    _mapped_ptr = nullptr;
+    _map_event = cl::Event();
+}
+
+std::vector<cl::Event> gpu_buffer::get_transfer_deps(const std::vector<cl::Event>& deps) const {
+    // transfer queue isn't ordered with the main one, on which the buffer is cleared
+    std::vector<cl::Event> result(deps);
+    if (_fill_event())
+        result.push_back(_fill_event);
+    return result;
+}
+
+void gpu_buffer::write_async(const void* host_ptr, const std::vector<cl::Event>& deps, cl::Event& write_event) {
+    auto wait_list = get_transfer_deps(deps);
+    _context->transfer_queue().enqueueWriteBuffer(_buffer, CL_FALSE, 0, size(), host_ptr, &wait_list, &write_event);
+}
+
+void gpu_buffer::read_async(void* host_ptr, const std::vector<cl::Event>& deps, cl::Event& read_event) {
+    auto wait_list = get_transfer_deps(deps);
+    _context->transfer_queue().enqueueReadBuffer(_buffer, CL_FALSE, 0, size(), host_ptr, &wait_list, &read_event);
+}
+
 void gpu_buffer::fill(unsigned char pattern, event_impl::ptr ev) {
     cl::Event ev_ocl = dynamic_cast<base_event*>(ev.get())->get();
     _context->queue().enqueueFillBuffer<unsigned char>(_buffer, pattern, 0, size(), 0, &ev_ocl);
@@ -95,32 +173,10 @@ gpu_image2d::gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine, const la
     , _lock_count(0)
     , _mapped_ptr(nullptr)
 {
-    cl_channel_order order;
-    switch (layout.format)
-    {
-    case format::image_2d_weights_c1_b_fyx:
-        _width = layout.size.batch[0];
-        _height = layout.size.spatial[0] * layout.size.feature[0] * layout.size.spatial[1];
-        order = CL_R;
-        break;
-    case format::image_2d_weights_winograd_6x3_s1_fbxyb:
-        _height =  layout.size.feature[0];
-        _width = layout.size.spatial[0] * layout.size.batch[0] * layout.size.spatial[1] * 8 / 3;
-        order = CL_R;
-        break;
-    case format::image_2d_weights_winograd_6x3_s1_xfbyb:
-        _height = layout.size.feature[0] * layout.size.spatial[0] * 8 / 3;
-        _width =  layout.size.batch[0] * layout.size.spatial[1] ;
-        order = CL_R;
-        break;
-    case format::image_2d_weights_c4_fyx_b:
-        _width = layout.size.batch[0];
-        _height = layout.size.spatial[0] * layout.size.feature[0] * layout.size.spatial[1];
-        order = CL_RGBA;
-        break;
-    default:
-        throw error("unsupported image type!");
-    }
+    auto image_size = get_image_size(layout);
+    _width = image_size.first;
+    _height = image_size.second;
+    cl_channel_order order = layout.format == format::image_2d_weights_c4_fyx_b ? CL_RGBA : CL_R;
 
     cl_channel_type type = layout.data_type == data_types::f16 ? CL_HALF_FLOAT : CL_FLOAT;
     cl::ImageFormat imageFormat(order, type);
@@ -137,15 +193,45 @@ gpu_image2d::gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine, const la
     , _context(engine->get_context())
     , _lock_count(0)
     , _buffer(buffer)
+    , _width(buffer.getImageInfo<CL_IMAGE_WIDTH>())
+    , _height(buffer.getImageInfo<CL_IMAGE_HEIGHT>())
     , _mapped_ptr(nullptr)
 {
 
 }
 
-void* gpu_image2d::lock() {
+std::pair<size_t, size_t> gpu_image2d::get_image_size(const layout& layout)
+{
+    size_t width, height;
+    switch (layout.format)
+    {
+    case format::image_2d_weights_c1_b_fyx:
+    case format::image_2d_weights_c4_fyx_b:
+        width = layout.size.batch[0];
+        height = layout.size.spatial[0] * layout.size.feature[0] * layout.size.spatial[1];
+        break;
+    case format::image_2d_weights_winograd_6x3_s1_fbxyb:
+        height = layout.size.feature[0];
+        width = layout.size.spatial[0] * layout.size.batch[0] * layout.size.spatial[1] * 8 / 3;
+        break;
+    case format::image_2d_weights_winograd_6x3_s1_xfbyb:
+        height = layout.size.feature[0] * layout.size.spatial[0] * 8 / 3;
+        width = layout.size.batch[0] * layout.size.spatial[1];
+        break;
+    default:
+        throw error("unsupported image type!");
+    }
+    return{ width, height };
+}
+
+void* gpu_image2d::lock(lock_mode mode) {
     std::lock_guard<std::mutex> locker(_mutex);
     if (0 == _lock_count) {
-        _mapped_ptr = _context->queue().enqueueMapImage(_buffer, CL_TRUE, CL_MAP_WRITE, { 0, 0, 0 }, { _width, _height, 1 }, &_row_pitch, &_slice_pitch);
+        _mapped_ptr = _context->queue().enqueueMapImage(_buffer, CL_TRUE, lock_mode_to_cl_map_flags(mode), { 0, 0, 0 }, { _width, _height, 1 }, &_row_pitch, &_slice_pitch);
+        _mapped_mode = mode;
+    }
+    else {
+        check_nested_lock(_mapped_mode, mode);
     }
     _lock_count++;
     return _mapped_ptr;
@@ -62,30 +62,52 @@ struct gpu_buffer : public memory_impl {
     friend cldnn::memory_pool;
 
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer);
-    void* lock() override;
+    void* lock(lock_mode mode = lock_mode::read_write) override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
     const cl::Buffer& get_buffer() const {
-        assert(0 == _lock_count);
+        assert(0 == _lock_count || _async_mapped);
         return _buffer;
     }
 
+    // Asynchronous mapping for host code running on worker threads: map_async enqueues mapping after deps without
+    // blocking and unmap_async enqueues unmapping after deps (usually an event set by the worker). In between lock()
+    // returns the mapped pointer once the mapping completes; release_async_map is called when the worker is done.
+    // map_async returns false if the buffer is already mapped.
+    bool map_async(cl_map_flags flags, const std::vector<cl::Event>& deps, cl::Event& map_event);
+    void unmap_async(const std::vector<cl::Event>& deps, cl::Event& unmap_event);
+    void release_async_map();
+
+    // Copies between the whole buffer and host memory on the transfer queue of the context (see gpu_toolkit::transfer_queue),
+    // the host memory has to stay valid until the copy completes.
+    void write_async(const void* host_ptr, const std::vector<cl::Event>& deps, cl::Event& write_event);
+    void read_async(void* host_ptr, const std::vector<cl::Event>& deps, cl::Event& read_event);
+
 private:
-    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout);
+    // reset - the buffer is filled with zeros (asynchronously if the main queue is in-order, before any other use of it)
+    // host_ptr - storage of the buffer created with resource_flags::USE_HOST_PTR
+    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout, resource_flags flags, void* host_ptr, bool reset);
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, resource_flags flags, gpu_buffer::ptr to_copy);
+    std::vector<cl::Event> get_transfer_deps(const std::vector<cl::Event>& deps) const;
 
     std::shared_ptr<gpu_toolkit> _context;
     std::mutex _mutex;
     unsigned _lock_count;
     cl::Buffer _buffer;
     void* _mapped_ptr;
+    lock_mode _mapped_mode = lock_mode::read_write;
+    bool _async_mapped = false;
+    cl::Event _map_event;
+    cl::Event _fill_event;
 };
 
 struct gpu_image2d : public memory_impl {
     friend cldnn::memory_pool;
 
     gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Image2D& buffer);
-    void* lock() override;
+    // returns width and height of the image which stores data of given layout
+    static std::pair<size_t, size_t> get_image_size(const layout& layout);
+    void* lock(lock_mode mode = lock_mode::read_write) override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
     const cl::Image2D& get_buffer() const {
@@ -105,5 +127,6 @@ private:
     size_t _row_pitch;
     size_t _slice_pitch;
     void* _mapped_ptr;
+    lock_mode _mapped_mode = lock_mode::read_write;
 };
 } }
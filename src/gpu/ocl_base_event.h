@@ -20,8 +20,12 @@ public:
         _attached = valid;
     }
     uint64_t get_queue_stamp() const { return _queue_stamp; }
+    // queue which signals the event, any_queue for user events and events of unknown origin
+    uint16_t get_queue_id() const { return _queue_id; }
+    static constexpr uint16_t any_queue = 0xFFFF;
 protected:
     uint64_t _queue_stamp = 0;
+    uint16_t _queue_id = any_queue;
 };
 
 struct base_event : virtual public ocl_base_event
@@ -38,10 +42,11 @@ public:
         , _ctx(ctx)
     {}
 
-    void attach_ocl_event(const cl::Event& ev, const uint64_t q_stamp)
+    void attach_ocl_event(const cl::Event& ev, const uint64_t q_stamp, const uint16_t queue_id = any_queue)
     {
         _event = ev;
         _queue_stamp = q_stamp;
+        _queue_id = queue_id;
         _attached = true;
     }
 
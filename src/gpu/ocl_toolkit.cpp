@@ -21,6 +21,7 @@
 #include "command_queues_builder.h"
 #include "events_pool.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <ios>
@@ -64,10 +65,27 @@ namespace {
         ret += ")";
         return ret;
     }
+
+    // innermost execution scope of the calling thread
+    thread_local const cldnn::gpu::gpu_toolkit::execution_scope* current_scope = nullptr;
 }
 
 namespace cldnn { namespace gpu {
 
+gpu_toolkit::execution_scope::execution_scope(const gpu_toolkit& context, events_owner& events)
+    : _context(context)
+    , _events(events)
+    , _outer(current_scope)
+    , _queue(context.get_current_queue())
+{
+    current_scope = this;
+}
+
+gpu_toolkit::execution_scope::~execution_scope()
+{
+    current_scope = _outer;
+}
+
 ocl_error::ocl_error(cl::Error const & err) : error(err.what() + std::string(", error code: ") + std::to_string(err.err()))
 {
 }
@@ -119,6 +137,9 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
             << "    out-of-order: "        << std::boolalpha << _configuration.host_out_of_order << "\n"
             << "    engine log: "          << _configuration.log << "\n"
             << "    sources dumps: "       << _configuration.ocl_sources_dumps_dir << "\n"
+            << "    kernels cache: "       << _configuration.kernels_cache_dir << "\n"
+            << "    compilation threads: " << _configuration.n_threads << "\n"
+            << "    command queues: "      << _command_queues.size() << "\n"
             << "\nEngine info:\n"
             << "    device id: "           << _engine_info.dev_id << "\n"
             << "    cores count: "         << _engine_info.cores_count << "\n"
@@ -137,7 +158,8 @@ void gpu_toolkit::build_command_queues(const configuration& config)
 {
     command_queues_builder queue_builder(_context, _ocl_builder.get_device(), _platform_id);
     queue_builder.set_profiling(config.enable_profiling);
-    queue_builder.set_out_of_order((config.host_out_of_order && _neo_driver));
+    _out_of_order = config.host_out_of_order && _neo_driver;
+    queue_builder.set_out_of_order(_out_of_order);
 
     bool priorty_extensions = extension_supported("cl_khr_priority_hints") && extension_supported("cl_khr_create_command_queue");
     queue_builder.set_priority_mode(config.priority_mode, priorty_extensions);
@@ -145,20 +167,44 @@ void gpu_toolkit::build_command_queues(const configuration& config)
     bool throttle_extensions = extension_supported("cl_khr_throttle_hints") && extension_supported("cl_khr_create_command_queue");
     queue_builder.set_throttle_mode(config.throttle_mode, throttle_extensions);
 
-    queue_builder.build();
+    // several queues are used only in-order, branches of a network are synchronized by events
+    size_t queues_count = config.host_out_of_order ? 1 : std::max<size_t>(config.n_queues, 1);
+    _command_queues.clear();
+    for (size_t i = 0; i < queues_count; ++i)
+    {
+        queue_builder.build();
+        _command_queues.push_back(queue_builder.queue());
+    }
+}
 
-    _command_queue = queue_builder.queue();
+const cl::CommandQueue& gpu_toolkit::transfer_queue()
+{
+    std::call_once(_transfer_queue_created, [this]
+    {
+        command_queues_builder queue_builder(_context, _ocl_builder.get_device(), _platform_id);
+        queue_builder.set_profiling(_configuration.enable_profiling);
+        queue_builder.set_out_of_order(false);
+        queue_builder.build();
+        _transfer_queue = queue_builder.queue();
+    });
+    return _transfer_queue;
+}
+
+host_task_pool& gpu_toolkit::get_host_tasks()
+{
+    std::call_once(_host_tasks_created, [this] { _host_tasks.reset(new host_task_pool(_configuration.n_threads)); });
+    return *_host_tasks;
 }
 
 event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const & deps)
 {
     std::vector<cl::Event> dep_events;
     auto dep_events_ptr = &dep_events;
+    auto queue_id = get_current_queue();
+    auto& queue = _command_queues[queue_id];
     if (!_configuration.host_out_of_order)
     {
-        for (auto& dep : deps)
-            if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                dep_events.push_back(ocl_ev->get());
+        get_wait_list(deps, dep_events, queue_id);
     }
     else
     {
@@ -170,11 +216,11 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
     try {
         if (!_configuration.host_out_of_order || _output_event || _configuration.enable_profiling)
         {
-            _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
+            queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         }
         else
         {
-            _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, nullptr);
+            queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, nullptr);
         }
     }
     catch (cl::Error const& err) {
@@ -191,26 +237,26 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
 
         log(_queue_counter + 1, msg);
     }
-    return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter);
+    return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter, queue_id, get_events_owner());
 }
 
 event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const& deps)
 {
     if (deps.empty())
-        return _events_pool->get_from_user_pool(shared_from_this(), true);
+        return _events_pool->get_from_user_pool(shared_from_this(), true, get_events_owner());
 
     if (!_configuration.host_out_of_order)
     {
         cl::Event ret_ev;
+        auto queue_id = get_current_queue();
+        auto& queue = _command_queues[queue_id];
         if (!enabled_single_kernel())
         {
             std::vector<cl::Event> dep_events;
-            for (auto& dep : deps)
-                if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                    dep_events.push_back(ocl_ev->get());
+            get_wait_list(deps, dep_events, queue_id);
 
             try {
-                _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
+                queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
             } 
             catch (cl::Error const& err) {
                 throw ocl_error(err);
@@ -219,7 +265,7 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
         else
         {
             try {
-                _command_queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+                queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
             }
             catch (cl::Error const& err) {
                 throw ocl_error(err);
@@ -228,28 +274,50 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
 
         if (logging_enabled())
             log(_queue_counter + 1, "Marker with dependencies: " + events_list_to_string(deps));
-        return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter);
+        return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter, queue_id, get_events_owner());
     }
     else
     {
         sync_events(deps);
-        return _events_pool->get_from_base_pool(shared_from_this(), _last_barrier_ev, _last_barrier);
+        return _events_pool->get_from_base_pool(shared_from_this(), _last_barrier_ev, _last_barrier, 0, get_events_owner());
     }
 }
 
 event_impl::ptr gpu_toolkit::group_events(std::vector<event_impl::ptr> const& deps)
 { 
-    return _events_pool->get_from_group_pool(shared_from_this(), deps);
+    return _events_pool->get_from_group_pool(shared_from_this(), deps, get_events_owner());
 }
 
 event_impl::ptr gpu_toolkit::create_user_event(bool set)
 {
-    return _events_pool->get_from_user_pool(shared_from_this(), set);
+    return _events_pool->get_from_user_pool(shared_from_this(), set, get_events_owner());
+}
+
+void gpu_toolkit::reset_events(events_owner& owner)
+{
+    _events_pool->reset_events(owner);
+}
+
+const gpu_toolkit::execution_scope* gpu_toolkit::get_execution_scope() const
+{
+    for (auto scope = current_scope; scope; scope = scope->_outer)
+    {
+        if (&scope->_context == this)
+            return scope;
+    }
+    return nullptr;
+}
+
+events_owner* gpu_toolkit::get_events_owner() const
+{
+    auto scope = get_execution_scope();
+    return scope ? &scope->_events : nullptr;
 }
 
-void gpu_toolkit::reset_events()
+uint16_t gpu_toolkit::get_current_queue() const
 {
-    _events_pool->reset_events();
+    auto scope = get_execution_scope();
+    return scope ? scope->_queue : 0;
 }
 
 void gpu_toolkit::release_events_pool()
@@ -261,7 +329,36 @@ void gpu_toolkit::flush()
 {
     if (logging_enabled())
         log(0, "Flush");
-    queue().flush();
+    for (auto& queue : _command_queues)
+        queue.flush();
+}
+
+void gpu_toolkit::synchronize_queues()
+{
+    if (_command_queues.size() < 2)
+        return;
+
+    if (logging_enabled())
+        log(0, "Synchronize queues");
+
+    try {
+        // the main queue waits for markers of other queues, then other queues wait for the main one
+        std::vector<cl::Event> markers(_command_queues.size() - 1);
+        for (size_t i = 1; i < _command_queues.size(); ++i)
+        {
+            _command_queues[i].enqueueMarkerWithWaitList(nullptr, &markers[i - 1]);
+            _command_queues[i].flush();
+        }
+
+        std::vector<cl::Event> main_barrier(1);
+        _command_queues[0].enqueueBarrierWithWaitList(&markers, &main_barrier[0]);
+        _command_queues[0].flush();
+        for (size_t i = 1; i < _command_queues.size(); ++i)
+            _command_queues[i].enqueueBarrierWithWaitList(&main_barrier, nullptr);
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
 }
 void gpu_toolkit::release_pending_memory()
 {
@@ -270,7 +367,8 @@ void gpu_toolkit::release_pending_memory()
     */
     void* ptr = nullptr;
     ptr = _mm_malloc(4096, 4096);
-    queue().finish();
+    for (auto& queue : _command_queues)
+        queue.finish();
     try
     {
         cl::Buffer flusher(_context, CL_MEM_USE_HOST_PTR, (size_t)4096, ptr);
@@ -330,11 +428,11 @@ void gpu_toolkit::sync_events(std::vector<event_impl::ptr> const & deps)
         try {
             if (_output_event)
             { 
-                _command_queue.enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
+                _command_queues[0].enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
             }
             else
             {
-                _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
+                _command_queues[0].enqueueBarrierWithWaitList(nullptr, nullptr);
             }
             
         }
@@ -348,6 +446,28 @@ void gpu_toolkit::sync_events(std::vector<event_impl::ptr> const & deps)
     }
 }
 
+void gpu_toolkit::get_wait_list(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& wait_list, uint16_t current_queue)
+{
+    for (auto& dep : deps)
+    {
+        auto ocl_ev = dynamic_cast<base_event*>(dep.get());
+        if (!ocl_ev)
+            continue;
+
+        if (_command_queues.size() > 1)
+        {
+            // in-order queue orders its own commands, events of other queues are waited for at the joins of branches
+            // and their queues have to be flushed, so the awaited commands are submitted
+            auto queue_id = ocl_ev->get_queue_id();
+            if (queue_id == current_queue)
+                continue;
+            if (queue_id < _command_queues.size())
+                _command_queues[queue_id].flush();
+        }
+        wait_list.push_back(ocl_ev->get());
+    }
+}
+
 std::ofstream& gpu_toolkit::open_log()
 {
     if (!_logger->_log_file.is_open())
@@ -23,8 +23,10 @@
 #include "engine_info.h"
 #include "event_impl.h"
 #include "confiugration.h"
+#include "host_task_pool.h"
 
 #include <memory>
+#include <mutex>
 #include <chrono>
 
 namespace cldnn { 
@@ -42,6 +44,7 @@ public:
 };
 
 class events_pool;
+class events_owner;
 class gpu_toolkit;
 
 class context_holder
@@ -65,14 +68,46 @@ class gpu_toolkit : public std::enable_shared_from_this<gpu_toolkit>
 protected:
     gpu_toolkit(const configuration& aconfiguration = configuration());
 public:
+    // events acquired by the calling thread while the scope exists belong to the given owner (see reset_events)
+    // and kernels and markers are enqueued to the queue selected by set_queue, so networks executed by other threads
+    // aren't affected; scopes of nested network executions replace the outer one until they end
+    class execution_scope
+    {
+    public:
+        execution_scope(const gpu_toolkit& context, events_owner& events);
+        ~execution_scope();
+
+        execution_scope(const execution_scope&) = delete;
+        execution_scope& operator=(const execution_scope&) = delete;
+
+        // selected by network for every step of its execution plan, the queue of the outer scope is used by default
+        void set_queue(uint16_t id) { _queue = id < _context.get_queues_count() ? id : 0; }
+
+    private:
+        friend class gpu_toolkit;
+        const gpu_toolkit& _context;
+        events_owner& _events;
+        const execution_scope* _outer;
+        uint16_t _queue;
+    };
+
     static std::shared_ptr<gpu_toolkit> create(const configuration& cfg = configuration());
     const cl::Context& context() const { return _context; }
     const cl::Device& device() const { return _ocl_builder.get_device(); }
-    const cl::CommandQueue& queue() const { return _command_queue; }
+    // main queue, memory transfers are enqueued to it
+    const cl::CommandQueue& queue() const { return _command_queues[0]; }
+    const cl::CommandQueue& queue(uint16_t id) const { return _command_queues.at(id); }
+    uint16_t get_queues_count() const { return static_cast<uint16_t>(_command_queues.size()); }
+    // queue to which kernels and markers of the calling thread are enqueued, see execution_scope::set_queue
+    uint16_t get_current_queue() const;
+    // in-order queue for copies between host and device memory which overlap with execution (see pipeline_impl), created on first use
+    const cl::CommandQueue& transfer_queue();
     
     const configuration& get_configuration() const { return _configuration; }
     engine_info_internal get_engine_info() const { return _engine_info; }
     kernels_cache& get_kernels_cache() { return _kernels_cache; }
+    // workers for host primitives, started on first use
+    host_task_pool& get_host_tasks();
 
     kernels_binaries_container* get_binaries() { return &_binaries; }
     void store_binaries(const kernels_binaries_vector& binaries) { _binaries.push_back(binaries); }
@@ -91,24 +126,32 @@ public:
     event_impl::ptr enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(std::vector<event_impl::ptr> const& deps);
     event_impl::ptr group_events(std::vector<event_impl::ptr> const& deps);
-    void reset_events();
+    // resets events of the owner only, so events used by other networks stay valid
+    void reset_events(events_owner& owner);
+    // owner of events acquired by the calling thread (of its innermost execution_scope), nullptr outside of networks execution
+    events_owner* get_events_owner() const;
     event_impl::ptr create_user_event(bool set);
     void release_events_pool();
 
     void flush();
+    // commands enqueued so far to any queue are finished before commands enqueued later to any queue start
+    void synchronize_queues();
     void release_pending_memory();
     void wait_for_events(std::vector<event_impl::ptr> const& events);
 
     void log(uint64_t id, std::string const& msg);
     bool logging_enabled() const { return !_configuration.log.empty(); }
     bool is_neo_driver() { return _neo_driver; }
+    // commands of the main queue are ordered only by events (host_out_of_order is used only with the NEO driver)
+    bool is_out_of_order() const { return _out_of_order; }
 private:
     configuration _configuration;
     ocl_builder _ocl_builder;
     bool _user_context = false;
     bool _neo_driver = false;
+    bool _out_of_order = false;
     cl::Context _context;
-    cl::CommandQueue _command_queue;
+    std::vector<cl::CommandQueue> _command_queues;
     cl_platform_id _platform_id;
     engine_info_internal _engine_info;
     kernels_cache _kernels_cache;
@@ -121,11 +164,19 @@ private:
 
     std::string _extensions;
 
+    std::once_flag _transfer_queue_created;
+    cl::CommandQueue _transfer_queue;
+
+    std::once_flag _host_tasks_created;
+    std::unique_ptr<host_task_pool> _host_tasks;
+
     struct ocl_logger;
     std::unique_ptr<ocl_logger> _logger;
 
+    const execution_scope* get_execution_scope() const;
     //returns whether a barrier has been added
     void sync_events(std::vector<event_impl::ptr> const& deps);
+    void get_wait_list(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& wait_list, uint16_t current_queue);
     bool _output_event = false;
     std::ofstream& open_log();
 
@@ -15,10 +15,47 @@
 */
 
 #include "primitive_gpu_base.h"
+#include "memory_gpu.h"
+#include "ocl_user_event.h"
+#include "network_impl.h"
+#include "engine_impl.h"
+
+#include <algorithm>
+#include <mutex>
 
 namespace cldnn {
     namespace gpu {
 
+        namespace
+        {
+            // completes when memory used by a host task is unmapped, an exception thrown by the task is rethrown by wait
+            struct host_task_event : public base_event
+            {
+                host_task_event(std::shared_ptr<gpu_toolkit> ctx, const cl::Event& ev)
+                    : ocl_base_event(0, true)
+                    , base_event(ctx, ev)
+                {}
+
+                void set_error(std::exception_ptr error)
+                {
+                    std::lock_guard<std::mutex> lock(_error_mutex);
+                    _error = error;
+                }
+
+            private:
+                void wait_impl() override
+                {
+                    _event.wait();
+                    std::lock_guard<std::mutex> lock(_error_mutex);
+                    if (_error)
+                        std::rethrow_exception(_error);
+                }
+
+                std::mutex _error_mutex;
+                std::exception_ptr _error;
+            };
+        }
+
         bool is_any_user_cpu(const std::list<const program_node*>& users)
         {
             for (const auto& user : users)
@@ -28,5 +65,117 @@ namespace cldnn {
             }
             return false;
         }
+
+        event_impl::ptr run_host_task(primitive_inst& instance, const std::vector<event_impl::ptr>& events, std::function<void()> task)
+        {
+            auto& engine = instance.get_network().get_engine();
+            auto context = engine.get_context();
+            auto& host_tasks = context->get_host_tasks();
+            host_tasks.rethrow_error();
+
+            // memory used by the task: outputs of dependencies are read, own output is written
+            struct host_memory
+            {
+                memory_impl::ptr mem;
+                cl_map_flags flags;
+            };
+            std::vector<host_memory> memory;
+            auto add_memory = [&memory](memory_impl& mem, cl_map_flags flags)
+            {
+                auto it = std::find_if(memory.begin(), memory.end(), [&mem](const host_memory& m) { return m.mem.get() == &mem; });
+                if (it == memory.end())
+                    memory.push_back({ &mem, flags });
+                else
+                    it->flags |= flags;
+            };
+            for (const auto& dep : instance.dependencies())
+                add_memory(dep->output_memory(), CL_MAP_READ);
+            add_memory(instance.output_memory(), CL_MAP_WRITE);
+
+            bool async = !context->is_out_of_order() &&
+                std::all_of(memory.begin(), memory.end(), [](const host_memory& m) { return dynamic_cast<gpu_buffer*>(m.mem.get()) != nullptr; });
+
+            std::vector<cl::Event> map_events;
+            if (async)
+            {
+                std::vector<cl::Event> deps;
+                for (const auto& ev : events)
+                    if (auto ocl_ev = dynamic_cast<base_event*>(ev.get()))
+                        deps.push_back(ocl_ev->get());
+
+                for (const auto& m : memory)
+                {
+                    cl::Event map_event;
+                    if (!static_cast<gpu_buffer&>(*m.mem).map_async(m.flags, deps, map_event))
+                        break;
+                    map_events.push_back(map_event);
+                }
+
+                // some memory is locked by someone else
+                if (map_events.size() != memory.size())
+                {
+                    for (size_t i = 0; i < map_events.size(); i++)
+                    {
+                        auto& buffer = static_cast<gpu_buffer&>(*memory[i].mem);
+                        cl::Event unmap_event;
+                        buffer.unmap_async({}, unmap_event);
+                        buffer.release_async_map();
+                    }
+                    async = false;
+                }
+            }
+
+            if (!async)
+            {
+                for (auto& a : events)
+                    a->wait();
+                task();
+                return engine.create_user_event(true);
+            }
+
+            // not taken from the events pool, the pool may reuse its events before the task completes
+            auto done_event = new user_event(context);
+            event_impl::ptr done(done_event, false);
+            done_event->attach_event(false);
+
+            // main queue is in-order, so the last unmapping completes after all of them
+            std::vector<cl::Event> unmap_deps = { done_event->get() };
+            cl::Event unmap_event;
+            for (const auto& m : memory)
+                static_cast<gpu_buffer&>(*m.mem).unmap_async(unmap_deps, unmap_event);
+            auto result_event = new host_task_event(context, unmap_event);
+            event_impl::ptr result(result_event, false);
+
+            // started from the completion callback of the mappings, which must not block, so it only queues the task
+            auto job = new std::function<void(bool)>([&host_tasks, task, memory, done, done_event, result, result_event](bool mapped)
+            {
+                host_tasks.submit([&host_tasks, task, memory, done, done_event, result, result_event, mapped]()
+                {
+                    try
+                    {
+                        if (!mapped)
+                            throw std::runtime_error("mapping memory for host primitive failed");
+                        task();
+                    }
+                    catch (...)
+                    {
+                        result_event->set_error(std::current_exception());
+                        host_tasks.set_error(std::current_exception());
+                    }
+
+                    for (const auto& m : memory)
+                        static_cast<gpu_buffer&>(*m.mem).release_async_map();
+                    done_event->set();
+                });
+            });
+            map_events.back().setCallback(CL_COMPLETE, [](cl_event, cl_int status, void* data)
+            {
+                std::unique_ptr<std::function<void(bool)>> job(static_cast<std::function<void(bool)>*>(data));
+                (*job)(status == CL_COMPLETE);
+            }, job);
+            context->flush();
+
+            return result;
+        }
     }
 }
\ No newline at end of file
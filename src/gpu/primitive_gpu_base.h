@@ -24,12 +24,22 @@
 #include "error_handler.h"
 #include "kernel_selector_helper.h"
 
+#include <functional>
+
 namespace cldnn { namespace gpu
 {
 
 // checks if any user in a list is a cpu primitive
 bool is_any_user_cpu(const std::list<const program_node*>& users);
 
+// Runs host code of a primitive which reads the outputs of its dependencies and writes its own output (detection
+// output, proposal, ...). The memory is mapped after the events without blocking the caller, the task runs on a worker
+// once the mapping completes and the returned event completes after the memory is unmapped, so the caller can keep
+// enqueueing independent work. An exception thrown by the task is rethrown by wait of the returned event and by the next
+// run_host_task of the context. Out of order queues and memory other than buffers fall back to waiting for the events
+// and running the task on the calling thread.
+event_impl::ptr run_host_task(primitive_inst& instance, const std::vector<event_impl::ptr>& events, std::function<void()> task);
+
 /*
 Base class for all GPU implementation of specified primitive type.
 For example, all gpu convolution implementations should derive from typed_primitive_gpu_impl<convolution>.
@@ -42,6 +52,10 @@ struct typed_primitive_gpu_impl : public typed_primitive_impl<PType>
     kernel_selector::kernel_data _kernel_data;
     std::vector<gpu::kernel> _kernels;
     std::vector<memory_impl::cptr> _intermediates_memory;
+    // instance which memory is bound as arguments of _kernels (impls are shared between networks built from the same program)
+    const primitive_inst* _bound_instance = nullptr;
+    // learning rate can be changed between executions, so such kernels have their arguments set every time
+    bool _uses_learning_rate = false;
 
     typed_primitive_gpu_impl(const typed_program_node<PType>& arg, const kernel_selector::kernel_data& kd)
         : typed_primitive_impl<PType>(kd.weightsReorderParams, kd.kernelName)
@@ -54,6 +68,9 @@ struct typed_primitive_gpu_impl : public typed_primitive_impl<PType>
         {
             gpu::kernel kernel(_outer.get_program().get_engine().get_context(), kd.kernels[i].kernelString);
             _kernels.emplace_back(std::move(kernel));
+
+            for (const auto& kernel_arg : kd.kernels[i].arguments)
+                _uses_learning_rate |= kernel_arg.t == kernel_selector::kernel_argument_types::LEARNING_RATE;
         }
 
         for (auto size : kd.internalBufferSizes)
@@ -103,6 +120,20 @@ protected:
         return 1;
     }
 
+    // checks if kernels have to get their arguments again, i.e. any memory used by the instance could have been replaced
+    bool arguments_changed(const typed_primitive_inst<PType>& instance) const
+    {
+        if (_bound_instance != &instance || _uses_learning_rate || instance.output_changed())
+            return true;
+
+        for (const auto& dep : instance.dependencies())
+        {
+            if (dep->output_changed())
+                return true;
+        }
+        return false;
+    }
+
     event_impl::ptr aggregate_events(const std::vector<event_impl::ptr>& events, bool group=false) const
     {
         if (events.size() == 1)
@@ -122,6 +153,7 @@ protected:
         }
 
         std::vector<event_impl::ptr> tmp_events(events);
+        const bool set_arguments = arguments_changed(instance);
 
         // TODO - split should be handle in kernel selector by providing multiple kernels.
         auto split = get_split();
@@ -135,13 +167,18 @@ protected:
             std::vector<event_impl::ptr> new_events;
             for (decltype(split) i = 0; i < split; i++)
             {
-                auto args = get_arguments(instance, i);
-                args.scalars = &_kernel_data.kernels[k].scalars;
-                args.split = i;
-
-                for (const auto& m : _intermediates_memory)
+                if (set_arguments)
                 {
-                    args.intermediates.push_back(m);
+                    auto args = get_arguments(instance, i);
+                    args.scalars = &_kernel_data.kernels[k].scalars;
+                    args.split = i;
+
+                    for (const auto& m : _intermediates_memory)
+                    {
+                        args.intermediates.push_back(m);
+                    }
+
+                    _kernels[k].set_arguments(_kernel_data.kernels[k], args);
                 }
 
                 //is any user of the prim's users is an detecion output, set prim as a output event (event won't be nullptr)
@@ -156,12 +193,13 @@ protected:
                     _kernels[k].set_output_event(instance.node.is_output());
                 }
     
-                auto event = _kernels[k].run(_kernel_data.kernels[k], tmp_events, args);
+                auto event = _kernels[k].run(_kernel_data.kernels[k], tmp_events, i);
                 new_events.push_back(event);
             }
 
             tmp_events = new_events;
         }
+        _bound_instance = &instance;
 
         bool group_events = split > 1 ? true : false;
         return aggregate_events(tmp_events, group_events);
@@ -16,6 +16,7 @@
 
 #include "proposal_inst.h"
 #include "kernel.h"
+#include "primitive_gpu_base.h"
 #include "implementation_map.h"
 #include "network_impl.h"
 #include "engine_impl.h"
@@ -356,24 +357,17 @@ struct proposal_gpu : typed_primitive_impl<proposal>
 
     event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, proposal_inst& instance) override
     {
-        for (auto& a : events) 
+        return run_host_task(instance, events, [this, &instance]()
         {
-            a->wait();
-        }
-
-        auto ev = instance.get_network().get_engine().create_user_event(false);
-
-        if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16)
-        {
-            execute<data_type_to_type<data_types::f16>::type>(instance);
-        }
-        else
-        {
-            execute<data_type_to_type<data_types::f32>::type>(instance);
-        }
-
-        dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
-        return ev;
+            if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16)
+            {
+                execute<data_type_to_type<data_types::f16>::type>(instance);
+            }
+            else
+            {
+                execute<data_type_to_type<data_types::f32>::type>(instance);
+            }
+        });
     }
 
     static primitive_impl* create(const proposal_node& arg) 
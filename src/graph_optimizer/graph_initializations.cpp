@@ -25,6 +25,7 @@
 #include "lstm_inst.h"
 #include "reshape_inst.h"
 #include "upsampling_inst.h"
+#include "gpu/ocl_toolkit.h"
 
 #include <iomanip>
 
@@ -347,6 +348,151 @@ namespace cldnn
         }
     }
 
+    // Replaces the lstm node by the single kernel implementation of the whole sequence (lstm_gpu) if it supports the layer.
+    // The kernel gets the input projection of all the sequence elements (add_lstm_input_projection) of each direction
+    // concatenated along y, so it multiplies only the hidden state at each step.
+    bool graph_initializations::fuse_lstm_sequence(program_impl& p, lstm_node& node)
+    {
+        // a single work group per batch and direction multiplies all the recurrent weights at each step, while the
+        // unrolled lstm_gemm kernels spread the gates over the device, so only layers with small hidden states are fused
+        const int32_t max_hidden_size = 128;
+
+        // the fused node is visited again by handle_lstm after it has been renamed
+        if (node.projected_input())
+            return true;
+        if (!p.get_options().get<build_option_type::optimize_data>()->enabled())
+            return false;
+
+        auto lstm_prim = node.typed_desc();
+        size_t input_count = node.sequence_len();
+
+        // stacked layers are connected through the hidden states of each step
+        for (auto& user : node.get_users())
+        {
+            if (user->is_type<lstm>())
+                return false;
+        }
+        for (size_t i = 0; i < input_count; ++i)
+        {
+            auto& input = node.get_dependency(i);
+            auto input_layout = input.get_output_layout();
+            if (input.is_type<lstm>() || input_layout.format != format::bfyx ||
+                (input_layout.data_type != data_types::f32 && input_layout.data_type != data_types::f16))
+                return false;
+            if (input_count > 1 && input_layout.size.feature[0] != 1)
+                return false;
+        }
+
+        // a work group keeps the gates and the hidden state of a step in local memory
+        auto recurrent_size = p.nodes_map.at(lstm_prim->recurrent)->get_output_layout().size;
+        auto hidden_size = recurrent_size.spatial[0];
+        auto local_memory = 5 * static_cast<uint64_t>(hidden_size) * sizeof(float);
+        if (hidden_size > max_hidden_size || local_memory > p.get_engine().get_context()->get_engine_info().max_local_mem_size)
+            return false;
+
+        program_node* sequence_input = &node.get_dependency(0);
+        size_t sequence_len = input_count;
+        if (input_count == 1)
+        {
+            sequence_len = sequence_input->get_output_layout().size.feature[0];
+        }
+        else
+        {
+            std::vector<primitive_id> element_ids;
+            for (size_t i = 0; i < input_count; ++i)
+                element_ids.push_back(node.get_dependency(i).get_org_primitive_id());
+            auto sequence_concat = std::make_shared<concatenation>(node.id() + ":input_sequence", element_ids, concatenation::along_f);
+            sequence_input = &p.get_or_create(sequence_concat);
+            for (size_t i = 0; i < input_count; ++i)
+                p.add_connection(node.get_dependency(i), *sequence_input);
+        }
+        auto input_directions = static_cast<uint32_t>(sequence_input->get_output_layout().size.spatial[1]);
+
+        // [batch, sequence, 4 * hidden_size, direction]
+        size_t directions = recurrent_size.feature[0];
+        std::vector<program_node*> projections;
+        for (size_t dir = 0; dir < directions; ++dir)
+        {
+            projections.push_back(&add_lstm_input_projection(p, *sequence_input, sequence_len, node.id() + ":input_projection" + get_id_string(dir),
+                                                             lstm_prim->weights, lstm_prim->recurrent, lstm_prim->bias, dir));
+        }
+        program_node* projection = projections[0];
+        if (directions > 1)
+        {
+            std::vector<primitive_id> projection_ids;
+            for (auto direction_projection : projections)
+                projection_ids.push_back(direction_projection->id());
+            auto projection_concat = std::make_shared<concatenation>(node.id() + ":input_projection", projection_ids, concatenation::along_y);
+            projection = &p.get_or_create(projection_concat);
+            for (auto direction_projection : projections)
+                p.add_connection(*direction_projection, *projection);
+        }
+
+        // the bias is added by the projection
+        auto sequence_prim = std::make_shared<lstm>(node.id() + ":sequence", std::vector<primitive_id>{ projection->id() },
+            lstm_prim->weights, lstm_prim->recurrent, "", lstm_prim->initial_hidden, lstm_prim->initial_cell,
+            lstm_prim->peepholes, lstm_prim->clip, lstm_prim->input_forget, lstm_prim->activations, lstm_prim->activation_params,
+            lstm_prim->output_selection, lstm_prim->offset_order, lstm_prim->get_output_padding());
+        auto& sequence_node = p.get_or_create(sequence_prim);
+        sequence_node.as<lstm>().set_projected_input(input_directions);
+        p.add_connection(*projection, sequence_node);
+        p.add_connection(*p.nodes_map.at(lstm_prim->weights), sequence_node);
+        p.add_connection(*p.nodes_map.at(lstm_prim->recurrent), sequence_node);
+        if (!lstm_prim->initial_hidden.empty())
+            p.add_connection(*p.nodes_map.at(lstm_prim->initial_hidden), sequence_node);
+        if (!lstm_prim->initial_cell.empty())
+            p.add_connection(*p.nodes_map.at(lstm_prim->initial_cell), sequence_node);
+
+        primitive_id original_id = node.id();
+        p.replace_all_usages(node, sequence_node);
+        p.remove_all_connections(node);
+        p.nodes_map.erase(original_id);
+        p.rename(sequence_node, original_id);
+        return true;
+    }
+
+    // Input part of the gates (weights * x_t + bias) of all the sequence elements for one direction, computed by a single
+    // lstm_gemm: [batch, sequence, 4 * hidden_size, 1]
+    program_node& graph_initializations::add_lstm_input_projection(program_impl& p, program_node& sequence_input, size_t sequence_len,
+        const primitive_id& projection_id, const primitive_id& weights_id, const primitive_id& recurrent_id, const primitive_id& bias_id, size_t dir)
+    {
+        // sequence elements are moved to the batch, so a single lstm_gemm multiplies all of them
+        auto sequence_size = sequence_input.get_output_layout().size;
+        auto rows = std::make_shared<reshape>(projection_id + ":rows", sequence_input.id(),
+            tensor(sequence_size.batch[0] * static_cast<tensor::value_type>(sequence_len), 1, sequence_size.spatial[0], sequence_size.spatial[1]));
+        auto& rows_node = p.get_or_create(rows);
+        p.add_connection(sequence_input, rows_node);
+
+        // lstm_gemm output has a feature per direction of the recurrent weights, but only the first one is written, so the
+        // gemm gets the recurrent weights of its direction (without a hidden state they set the output size only)
+        auto& recurrent = *p.nodes_map.at(recurrent_id);
+        auto recurrent_size = recurrent.get_output_layout().size;
+        program_node* gemm_recurrent = &recurrent;
+        if (recurrent_size.feature[0] > 1)
+        {
+            auto direction_recurrent = std::make_shared<crop>(projection_id + ":recurrent", recurrent_id,
+                tensor(recurrent_size.batch[0], 1, recurrent_size.spatial[0], recurrent_size.spatial[1]),
+                tensor(0, static_cast<tensor::value_type>(dir), 0, 0));
+            gemm_recurrent = &p.get_or_create(direction_recurrent);
+            p.add_connection(recurrent, *gemm_recurrent);
+        }
+
+        auto projection_gemm = std::make_shared<lstm_gemm>(projection_id + ":gemm", rows_node.id(), weights_id, gemm_recurrent->id(), bias_id, "", (uint32_t)dir);
+        auto& projection_gemm_node = p.get_or_create(projection_gemm);
+        p.add_connection(rows_node, projection_gemm_node);
+        p.add_connection(*p.nodes_map.at(weights_id), projection_gemm_node);
+        p.add_connection(*gemm_recurrent, projection_gemm_node);
+        if (!bias_id.empty())
+            p.add_connection(*p.nodes_map.at(bias_id), projection_gemm_node);
+
+        auto gates_size = p.nodes_map.at(weights_id)->get_output_layout().size.spatial[1];
+        auto projection = std::make_shared<reshape>(projection_id, projection_gemm_node.id(),
+            tensor(sequence_size.batch[0], static_cast<tensor::value_type>(sequence_len), gates_size, 1));
+        auto& projection_node = p.get_or_create(projection);
+        p.add_connection(projection_gemm_node, projection_node);
+        return projection_node;
+    }
+
     void graph_initializations::handle_lstm(program_impl& p)
     {
         bool has_lstm_children;
@@ -358,6 +504,9 @@ namespace cldnn
             has_lstm_children = false;
             // replace lstm node with lstm_gemm and lstm_elt nodes
             if (node->is_type<lstm>()) {
+                if (fuse_lstm_sequence(p, node->as<lstm>()))
+                    continue;
+
                 bool initial_hidden_term = node->as<lstm>().initial_hidden_term();
                 bool initial_cell_term = node->as<lstm>().initial_cell_term();
                 bool bias_term = node->as<lstm>().bias_term();
@@ -393,6 +542,10 @@ namespace cldnn
                 size_t input_vector_size = node->as<lstm>().sequence_len();
                 size_t sequence_len = input_vector_size;
 
+                // The input part of the gates (weights * x_t + bias) doesn't depend on the previous steps, so it is computed
+                // for the whole sequence by a single lstm_gemm per direction and the steps multiply only the hidden state.
+                bool hoist_input_projection = false;
+
                 // Calculate the input sequence length for the lstm node
                 // Case 1: If the input comes in as a concatenated input i.e. the
                 // input is not divided into sequence elements
@@ -406,10 +559,12 @@ namespace cldnn
                     // Get the sequence length from the input to LSTM
                     sequence_len = input_layout.size.feature[0];
 
+                    hoist_input_projection = sequence_len > 1 && input_layout.format == format::bfyx;
+
                     // If the input's feature/sequence length field is > 1, i.e. If
                     // the sequence elements are concatenated into one single input
                     // then it has to be split into individual sequence elements
-                    if (sequence_len > 1)
+                    if (sequence_len > 1 && !hoist_input_projection)
                     {
                         for (size_t sequence_element = 0; sequence_element < sequence_len; sequence_element++)
                         {
@@ -444,6 +599,17 @@ namespace cldnn
                     sequence_len = (directions == 1) ? num_input_dependencies : num_input_dependencies / 2;
                 }
 
+                // sequence elements given as separate inputs are concatenated for the projection
+                if (num_input_dependencies > 1 && sequence_len > 1)
+                {
+                    hoist_input_projection = true;
+                    for (auto dep : node->get_dependencies())
+                    {
+                        if (dep->get_output_layout().format != format::bfyx)
+                            hoist_input_projection = false;
+                    }
+                }
+
                 //check if this lstm node has an lstm child
                 for (auto& user : node->get_users())
                 {
@@ -463,10 +629,45 @@ namespace cldnn
                 std::map<size_t, std::pair<primitive_id, program_node*>> output_map;
                 auto dependencies = node->get_dependencies();
 
+                // stacked layers take the hidden states of each direction of the previous layer as separate inputs
+                bool stacked = num_input_dependencies > sequence_len;
+                auto gates_size = p.nodes_map.at(weights_id)->get_output_layout().size.spatial[1];
+                std::map<size_t, program_node*> sequence_inputs; // index of the first input -> whole sequence input of the projection
+
                 //lstm expanding
                 for (size_t dir = 0; dir < directions; ++dir) {
                     auto hidden_id = initial_hidden_id;
                     auto cell_id = initial_cell_id;
+
+                    // input projection of all the sequence elements: [batch, sequence, 4 * hidden_size, 1]
+                    program_node* projection = nullptr;
+                    size_t first_input = stacked ? dir * sequence_len : 0;
+                    if (hoist_input_projection)
+                    {
+                        auto& sequence_input = sequence_inputs[first_input];
+                        if (!sequence_input)
+                        {
+                            if (num_input_dependencies == 1)
+                            {
+                                sequence_input = &node->get_dependency(0);
+                            }
+                            else
+                            {
+                                std::vector<primitive_id> element_ids;
+                                for (size_t i = 0; i < sequence_len; ++i)
+                                    element_ids.push_back(node->get_dependency(first_input + i).get_org_primitive_id());
+                                auto sequence_concat = std::make_shared<concatenation>(node->id() + ":input_sequence" + get_id_string(first_input),
+                                                                                       element_ids, concatenation::along_f);
+                                sequence_input = &p.get_or_create(sequence_concat);
+                                for (size_t i = 0; i < sequence_len; ++i)
+                                    p.add_connection(node->get_dependency(first_input + i), *sequence_input);
+                            }
+                        }
+
+                        projection = &add_lstm_input_projection(p, *sequence_input, sequence_len, node->id() + ":input_projection" + get_id_string(dir),
+                                                                weights_id, recurrent_id, bias_id, dir);
+                    }
+
                     for (size_t i = 0; i < sequence_len; ++i) {
                         size_t idx = i + dir * sequence_len;
                         primitive_id lstm_gemm_id = node->id() + ":lstm_gemm" + get_id_string(idx);
@@ -488,42 +689,63 @@ namespace cldnn
                             }
                         }
 
-                        //primitive_id lstm_gemm_input_id = node->get_dependency(input_idx).get_primitive()->get_id();
-                        //the line below requires an attention: get_org_primitive_id() might not be an actual id of a node (see rename method)
-                        //ToDO: ensure that get_org_primitive_id() is suitable here
-                        primitive_id lstm_gemm_input_id = node->get_dependency(input_idx).get_org_primitive_id();
+                        // gates of the step: [batch, direction, 4 * hidden_size, 1]
+                        program_node* gates = nullptr;
+                        if (hoist_input_projection)
+                        {
+                            auto step_projection = std::make_shared<crop>(crop_id + ":input_projection", projection->id(),
+                                tensor(hidden_size.batch[0], 1, gates_size, 1), tensor(0, static_cast<tensor::value_type>(input_idx - first_input), 0, 0));
+                            gates = &p.get_or_create(step_projection);
+                            p.add_connection(*projection, *gates);
 
-                        auto lstm_gemm_node = std::make_shared<lstm_gemm>(lstm_gemm_id, lstm_gemm_input_id, weights_id, recurrent_id, bias_id, hidden_id, (uint32_t)dir);
-                        auto &n1 = p.get_or_create(lstm_gemm_node);
+                            // without a hidden state the projection is the whole gates input of the step
+                            if (i > 0 || initial_hidden_term)
+                            {
+                                auto lstm_gemm_node = std::make_shared<lstm_gemm>(lstm_gemm_id, gates->id(), "", recurrent_id, "", hidden_id, (uint32_t)dir);
+                                auto &n1 = p.get_or_create(lstm_gemm_node);
+                                p.add_connection(*gates, n1);
+                                p.add_connection(*p.nodes_map.at(recurrent_id), n1);
+                                p.add_connection(i > 0 ? *hidden_list[size_t(i - 1) * directions + dir] : *p.nodes_map.at(hidden_id), n1);
+                                gates = &n1;
+                            }
+                        }
+                        else
+                        {
+                            //primitive_id lstm_gemm_input_id = node->get_dependency(input_idx).get_primitive()->get_id();
+                            //the line below requires an attention: get_org_primitive_id() might not be an actual id of a node (see rename method)
+                            //ToDO: ensure that get_org_primitive_id() is suitable here
+                            primitive_id lstm_gemm_input_id = node->get_dependency(input_idx).get_org_primitive_id();
+
+                            auto lstm_gemm_node = std::make_shared<lstm_gemm>(lstm_gemm_id, lstm_gemm_input_id, weights_id, recurrent_id, bias_id, hidden_id, (uint32_t)dir);
+                            auto &n1 = p.get_or_create(lstm_gemm_node);
+                            //adding dependecy to lstm_gemm node
+                            //input
+                            p.add_connection(node->get_dependency(input_idx), n1);
+                            //adding weights and initial values to lstm_gemm
+                            p.add_connection(*p.nodes_map.at(weights_id), n1);
+                            p.add_connection(*p.nodes_map.at(recurrent_id), n1);
+                            if (bias_term)
+                                p.add_connection(*p.nodes_map.at(bias_id), n1);
+                            //adding hiddens as dependencies
+                            if (i > 0)
+                                p.add_connection(*hidden_list[size_t(i - 1) * directions + dir], n1);
+                            else if (initial_hidden_term)
+                                p.add_connection(*p.nodes_map.at(hidden_id), n1);
+                            gates = &n1;
+                        }
 
-                        auto lstm_elt_node = std::make_shared<lstm_elt>(lstm_elt_id, lstm_gemm_id, cell_id, lstm_prim->clip, lstm_prim->input_forget,
+                        auto lstm_elt_node = std::make_shared<lstm_elt>(lstm_elt_id, gates->id(), cell_id, lstm_prim->clip, lstm_prim->input_forget,
                             lstm_prim->activations, lstm_prim->activation_params, lstm_prim->offset_order, (uint32_t)dir);
                         auto &n2 = p.get_or_create(lstm_elt_node);
                         //adding lstm_elt as user
-                        p.add_connection(n1, n2);
-                        //adding dependecy to lstm_gemm node
-                        //input
-                        p.add_connection(node->get_dependency(input_idx), n1);
-                        //adding weights and initial values to lstm_gemm
-                        p.add_connection(*p.nodes_map.at(weights_id), n1);
-                        p.add_connection(*p.nodes_map.at(recurrent_id), n1);
-                        if (bias_term)
-                            p.add_connection(*p.nodes_map.at(bias_id), n1);
-
-                        //adding cell and hiddens as dependencies
+                        p.add_connection(*gates, n2);
+
+                        //adding cell as dependency
                         if (i > 0)
-                        {
                             p.add_connection(*cell_list[size_t(i - 1) * directions + dir], n2);
-                            p.add_connection(*hidden_list[size_t(i - 1) * directions + dir], n1);
-                        }
                         //if initial values are present
-                        else
-                        {
-                            if (initial_hidden_term)
-                                p.add_connection(*p.nodes_map.at(hidden_id), n1);
-                            if (initial_cell_term)
-                                p.add_connection(*p.nodes_map.at(cell_id), n2);
-                        }
+                        else if (initial_cell_term)
+                            p.add_connection(*p.nodes_map.at(cell_id), n2);
 
                         //lstm_hidden
                         {
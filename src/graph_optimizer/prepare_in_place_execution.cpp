@@ -0,0 +1,104 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "program_helpers.h"
+#include "activation_inst.h"
+#include "concatenation_inst.h"
+#include "data_inst.h"
+#include "eltwise_inst.h"
+#include "input_layout_inst.h"
+#include "mutable_data_inst.h"
+
+using namespace cldnn;
+
+namespace {
+    // the input buffer can be overwritten only if nobody else reads it and nobody else writes into it
+    bool can_overwrite(const program_node& node, const program_node& input)
+    {
+        if (input.is_type<input_layout>() || input.is_type<data>() || input.is_type<mutable_data>() ||
+            input.is_output() || input.is_constant() || input.can_be_optimized() || !input.can_share_buffer())
+            return false;
+
+        for (auto user : input.get_users())
+        {
+            if (user != &node)
+                return false;
+        }
+
+        // every work item of eltwise and activation kernels reads the input elements at the same offsets as the output
+        // elements it writes, so the output overwrites only values which were already consumed
+        const auto& output_layout = node.get_output_layout();
+        return input.get_output_layout() == output_layout && !output_layout.format.is_image();
+    }
+
+    bool can_run_in_place(const program_node& node)
+    {
+        if (node.is_output() || node.can_be_optimized() || !node.can_share_buffer() || node.get_selected_impl() == nullptr)
+            return false;
+
+        // output written into a buffer of someone else can't be redirected
+        for (auto user : node.get_users())
+        {
+            if (user->is_type<mutable_data>() || (user->is_type<concatenation>() && user->can_be_optimized()))
+                return false;
+        }
+        return true;
+    }
+}
+
+// eltwise and activation write their output into the buffer of an input which is not used afterwards (e.g. residual
+// connections), which saves memory and cache traffic. Memory restrictions of such primitive are applied to the owner of
+// the buffer (see add_memory_dependency), so the buffer is not given to anybody else while any of them is alive.
+void prepare_in_place_execution::run(program_impl& p)
+{
+    for (auto node : p.get_processing_order())
+    {
+        if (!can_run_in_place(*node))
+            continue;
+
+        program_helpers::do_for_types<eltwise, activation>(*node,
+            [](eltwise_node& node)
+        {
+            // with strides or broadcasted inputs work items read elements at other offsets than they write
+            if (!node.get_primitive()->stride.empty())
+                return;
+            const auto& output_layout = node.get_output_layout();
+            for (size_t i = 0; i < node.inputs_count(); i++)
+            {
+                const auto& input_layout = node.input(i).get_output_layout();
+                if (input_layout.format != output_layout.format || input_layout.size != output_layout.size)
+                    return;
+            }
+
+            for (size_t i = 0; i < node.inputs_count(); i++)
+            {
+                if (can_overwrite(node, node.input(i)))
+                {
+                    node.set_in_place_input(&node.input(i));
+                    return;
+                }
+            }
+        },
+            [](activation_node& node)
+        {
+            if (can_overwrite(node, node.input()))
+                node.set_in_place_input(&node.input());
+        });
+    }
+}
@@ -18,135 +18,245 @@
 #include "api_impl.h"
 #include <immintrin.h>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CLDNN_TARGET_F16C
+#else
+#include <cpuid.h>
+#define CLDNN_TARGET_F16C __attribute__((target("avx,f16c")))
+#endif
 
 namespace cldnn {
-    float half_to_float(uint16_t value)
-    {
-        static const uint32_t FLOAT16_EXP_SHIFT = (23 - 10);
-        static const uint32_t FLOAT16_EXP_MASK = 0x7C00;
-        static const uint32_t FLOAT32_EXP_MASK = 0x7F800000;
-        static const uint32_t FLOAT16_MANTISSA_MASK = 0x03FF;
-        static const uint32_t FLOAT16_TO_32_BIAS_DIFF_DENORM = ((127 - 15 - 10) << 23); // The difference is (127-15) but we want to do the calculation in the exp place (bit 23:32)
-        static const uint32_t FLOAT16_TO_32_BIAS_DIFF = ((127 - 15) << 10);
-        static const uint32_t FLOAT16_IMPLICIT_1 = (1 << 10);
-        static const uint32_t FLOAT16_EXP_MIN = (1 << 10);
-        static const uint32_t FLOAT16_SIGN_MASK = 0x8000;
-        __m128i a = _mm_unpacklo_epi16(_mm_set1_epi16(value), _mm_setzero_si128());
-        __m128i exps = _mm_and_si128(_mm_set1_epi32(FLOAT16_EXP_MASK), a);          // Mask the exponents
-        __m128i mantissa = _mm_and_si128(_mm_set1_epi32(FLOAT16_MANTISSA_MASK), a); // Mask the mantissa
-        __m128i signs = _mm_and_si128(_mm_set1_epi32(FLOAT16_SIGN_MASK), a);
-        signs = _mm_slli_epi32(signs, 16);
-
-        __m128i nans = _mm_cmpeq_epi32(exps, _mm_set1_epi32(FLOAT16_EXP_MASK));
-        nans = _mm_and_si128(nans, _mm_set1_epi32(FLOAT32_EXP_MASK));
-        nans = _mm_or_si128(nans, signs);
-
-        __m128i subnormals = _mm_cmpeq_epi32(exps, _mm_setzero_si128());
-
-        int out32;
-        // e\m| 0 | 1
-        // ------------
-        //  0 | 0 | S
-        // ------------
-        //  1 | N | N
-        //
-        // The expression: (~exp) & mantissa, will evaluate to 0 exactly when the number is non subnormal or it's zero (just like in the table)
-        // testz Tests for this condition
-        if (_mm_testz_si128(subnormals, mantissa))
+    namespace {
+        // Both conversions work on 4 values, halves are kept in the low words of dwords.
+        __m128 half_to_float4(__m128i a)
         {
-            __m128i tmp;
-            exps = _mm_add_epi32(exps, _mm_set1_epi32(FLOAT16_TO_32_BIAS_DIFF));
-            tmp = _mm_or_si128(exps, mantissa);
-            tmp = _mm_slli_epi32(tmp, FLOAT16_EXP_SHIFT);
-            tmp = _mm_blendv_epi8(tmp, _mm_setzero_si128(), subnormals);    // The idea is of course to use blendv_ps, but epi8 will work the same and won't switch stack
-            tmp = _mm_or_si128(tmp, nans);
-            out32 = _mm_extract_epi32(tmp, 0);
-        }
-        else
-        {
-            __m128i normals = _mm_andnot_si128(subnormals, _mm_set1_epi32(FLOAT16_IMPLICIT_1)); // Mark all normal numbers
-            mantissa = _mm_or_si128(mantissa, normals);                                         // Apply implicit bit
-            exps = _mm_max_epi16(exps, _mm_set1_epi32(FLOAT16_EXP_MIN));                        // All subnormals will have 1 in the exponent (needed for correct bias computation)
-            exps = _mm_slli_epi32(exps, FLOAT16_EXP_SHIFT);
-            exps = _mm_add_epi32(exps, _mm_set1_epi32(FLOAT16_TO_32_BIAS_DIFF_DENORM));
-            __m128 tmp;
-            tmp = _mm_mul_ps(_mm_castsi128_ps(exps), _mm_cvtepi32_ps(mantissa));
-            tmp = _mm_or_ps(tmp, _mm_castsi128_ps(nans));
-            out32 = _mm_extract_ps(tmp, 0);
+            static const uint32_t FLOAT16_EXP_SHIFT = (23 - 10);
+            static const uint32_t FLOAT16_EXP_MASK = 0x7C00;
+            static const uint32_t FLOAT32_EXP_MASK = 0x7F800000;
+            static const uint32_t FLOAT32_QUIET_NAN_BIT = 0x00400000;
+            static const uint32_t FLOAT16_MANTISSA_MASK = 0x03FF;
+            static const uint32_t FLOAT16_TO_32_BIAS_DIFF_DENORM = ((127 - 15 - 10) << 23); // The difference is (127-15) but we want to do the calculation in the exp place (bit 23:32)
+            static const uint32_t FLOAT16_TO_32_BIAS_DIFF = ((127 - 15) << 10);
+            static const uint32_t FLOAT16_IMPLICIT_1 = (1 << 10);
+            static const uint32_t FLOAT16_EXP_MIN = (1 << 10);
+            static const uint32_t FLOAT16_SIGN_MASK = 0x8000;
+            __m128i exps = _mm_and_si128(_mm_set1_epi32(FLOAT16_EXP_MASK), a);          // Mask the exponents
+            __m128i mantissa = _mm_and_si128(_mm_set1_epi32(FLOAT16_MANTISSA_MASK), a); // Mask the mantissa
+            __m128i signs = _mm_and_si128(_mm_set1_epi32(FLOAT16_SIGN_MASK), a);
+            signs = _mm_slli_epi32(signs, 16);
+
+            __m128i specials = _mm_cmpeq_epi32(exps, _mm_set1_epi32(FLOAT16_EXP_MASK));
+            // NaNs are quieted and keep their payload, the same as in the F16C conversion
+            __m128i quiet = _mm_andnot_si128(_mm_cmpeq_epi32(mantissa, _mm_setzero_si128()), specials);
+            __m128i nans = _mm_and_si128(specials, _mm_set1_epi32(FLOAT32_EXP_MASK));
+            nans = _mm_or_si128(nans, _mm_and_si128(quiet, _mm_set1_epi32(FLOAT32_QUIET_NAN_BIT)));
+            nans = _mm_or_si128(nans, signs);
+
+            __m128i subnormals = _mm_cmpeq_epi32(exps, _mm_setzero_si128());
+
+            __m128i normal;
+            {
+                exps = _mm_add_epi32(exps, _mm_set1_epi32(FLOAT16_TO_32_BIAS_DIFF));
+                normal = _mm_or_si128(exps, mantissa);
+                normal = _mm_slli_epi32(normal, FLOAT16_EXP_SHIFT);
+                normal = _mm_blendv_epi8(normal, _mm_setzero_si128(), subnormals);    // The idea is of course to use blendv_ps, but epi8 will work the same and won't switch stack
+                normal = _mm_or_si128(normal, nans);
+            }
+            // e\m| 0 | 1
+            // ------------
+            //  0 | 0 | S
+            // ------------
+            //  1 | N | N
+            //
+            // The expression: (~exp) & mantissa, will evaluate to 0 exactly when the number is non subnormal or it's zero (just like in the table)
+            // testz Tests for this condition
+            if (_mm_testz_si128(subnormals, mantissa))
+                return _mm_castsi128_ps(normal);
+
+            __m128 denormal;
+            {
+                exps = _mm_and_si128(_mm_set1_epi32(FLOAT16_EXP_MASK), a);
+                __m128i normals = _mm_andnot_si128(subnormals, _mm_set1_epi32(FLOAT16_IMPLICIT_1)); // Mark all normal numbers
+                mantissa = _mm_or_si128(mantissa, normals);                                         // Apply implicit bit
+                exps = _mm_max_epi16(exps, _mm_set1_epi32(FLOAT16_EXP_MIN));                        // All subnormals will have 1 in the exponent (needed for correct bias computation)
+                exps = _mm_slli_epi32(exps, FLOAT16_EXP_SHIFT);
+                exps = _mm_add_epi32(exps, _mm_set1_epi32(FLOAT16_TO_32_BIAS_DIFF_DENORM));
+                denormal = _mm_mul_ps(_mm_castsi128_ps(exps), _mm_cvtepi32_ps(mantissa));
+                denormal = _mm_or_ps(denormal, _mm_castsi128_ps(nans));
+            }
+            // lanes with other values than subnormals (infinities, nans) are taken from the normal path
+            return _mm_blendv_ps(_mm_castsi128_ps(normal), denormal, _mm_castsi128_ps(subnormals));
         }
 
-        float outf32 = *(float*)&out32;
-        return outf32;
-    }
-    uint16_t float_to_half(float value)
-    {
+        // returns 4 halves in the low quad word
+        __m128i float_to_half4(__m128 Src)
+        {
 #define TO_M128i(a) (*(__m128i*)&(a))
 #define TO_M128(a) (*(__m128*)&(a))
 
-        static const uint32_t DWORD_SIGNMASK = 0x80000000;
-        static const uint32_t DWORD_MINFP16 = 0x38800000;
-        static const uint32_t DWORD_MAXFP16 = 0x477fe000;
-        static const uint32_t DWORD_FP16_2_POW_10 = (1 << 10);
-        static const uint32_t DWORD_FP16_EXPBIAS_NO_HALF = 0xc8000000;
-        static const uint32_t WORD_MAXFP16 = 0x7BFF;
+            static const uint32_t DWORD_SIGNMASK = 0x80000000;
+            static const uint32_t DWORD_MINFP16 = 0x38800000;
+            static const uint32_t DWORD_MAXFP16 = 0x477fe000;
+            static const uint32_t DWORD_FP16_2_POW_10 = (1 << 10);
+            static const uint32_t DWORD_FP16_EXPBIAS_NO_HALF = 0xc8000000;
+            static const uint32_t WORD_MAXFP16 = 0x7BFF;
+            static const uint32_t WORD_QNANFP16 = 0x7E00;
+            static const uint32_t WORD_MANTISSAFP16 = 0x03FF;
+
+            static const __m128i IVec4SignMask = _mm_set1_epi32(DWORD_SIGNMASK);
+            static const __m128i IVec4MinNormalFp16 = _mm_set1_epi32(DWORD_MINFP16);
+            static const __m128i IVec4MaxNormalFp16 = _mm_set1_epi32(DWORD_MAXFP16);
+            static const __m128i IVec4OnePow10 = _mm_set1_epi32(DWORD_FP16_2_POW_10);
+            static const __m128i IVec4ExpBiasFp16 = _mm_set1_epi32(DWORD_FP16_EXPBIAS_NO_HALF);
+            static const __m128i IVec4MaxFp16InWords = _mm_set1_epi32(WORD_MAXFP16);
+
+            static const __m128 FVec4MaxNormalFp16 = TO_M128(IVec4MaxNormalFp16);
+            static const __m128 FVec4MinNormalFp16 = TO_M128(IVec4MinNormalFp16);
+            static const __m128i IVec4InfF32 = _mm_set1_epi32(0x7f800000); //inf in in hex representation
+            static const __m128i IVec4InfF16 = _mm_set1_epi32(0x00007c00);
+            static const __m128i IVec4QNanF16 = _mm_set1_epi32(WORD_QNANFP16);
+            static const __m128i IVec4MantissaF16 = _mm_set1_epi32(WORD_MANTISSAFP16);
+
+            static const __m128 FVec4MaxFp16InWords = TO_M128(IVec4MaxFp16InWords);
 
-        static const __m128i IVec4SignMask = _mm_set1_epi32(DWORD_SIGNMASK);
-        static const __m128i IVec4MinNormalFp16 = _mm_set1_epi32(DWORD_MINFP16);
-        static const __m128i IVec4MaxNormalFp16 = _mm_set1_epi32(DWORD_MAXFP16);
-        static const __m128i IVec4OnePow10 = _mm_set1_epi32(DWORD_FP16_2_POW_10);
-        static const __m128i IVec4ExpBiasFp16 = _mm_set1_epi32(DWORD_FP16_EXPBIAS_NO_HALF);
-        static const __m128i IVec4MaxFp16InWords = _mm_set1_epi32(WORD_MAXFP16);
+            // Remove the sign bit from the source
+            __m128 AbsSrc = _mm_andnot_ps(TO_M128(IVec4SignMask), Src);
 
-        static const __m128 FVec4MaxNormalFp16 = TO_M128(IVec4MaxNormalFp16);
-        static const __m128 FVec4MinNormalFp16 = TO_M128(IVec4MinNormalFp16);
-        static const __m128i IVec4InfF32 = _mm_set1_epi32(0x7f800000); //inf in in hex representation
-        static const __m128i IVec4InfF16 = _mm_set1_epi32(0x00007c00);
+            // Create a mask to identify the DWORDs that are smaller than the minimum normalized fp16 number
+            __m128 CmpToMinFp16Mask = _mm_cmplt_ps(AbsSrc, FVec4MinNormalFp16);
 
-        static const __m128 FVec4MaxFp16InWords = TO_M128(IVec4MaxFp16InWords);
+            // Create a mask to identify the DWORDs that are larger than the maximum normalized fp16 number
+            __m128 CmpToMaxFp16Mask = _mm_cmpgt_ps(AbsSrc, FVec4MaxNormalFp16);
+            __m128i CmpToInfMask = _mm_cmpeq_epi32(TO_M128i(AbsSrc), IVec4InfF32);
+            // Create a mask with the minimum normalized fp16 number in the DWORDs that are smaller than it
+            __m128 MaskOfMinFp16 = _mm_and_ps(CmpToMinFp16Mask, FVec4MinNormalFp16);
 
-        __m128 Src = _mm_set1_ps(value);
+            __m128i MaskOf2POW10 = _mm_and_si128(TO_M128i(CmpToMinFp16Mask), IVec4OnePow10);
+            __m128 ResultPS = _mm_add_ps(AbsSrc, MaskOfMinFp16);
+            __m128i Result = TO_M128i(ResultPS);
 
-        // Remove the sign bit from the source
-        __m128 AbsSrc = _mm_andnot_ps(TO_M128(IVec4SignMask), Src);
+            // We need to move from a 127 biased domain to a 15 biased domain. This means subtracting 112 from the exponent. We will add '-112'
+            // to the exponent but since the exponent is shifted 23 bits to the left we need to shift '-112' 23 bits to the left as well.
+            // This gives us 0xC8000000. We are going to shift the mantissa 13 bits to the right (moving from 23 bits mantissa to 10).
+            Result = _mm_add_epi32(Result, IVec4ExpBiasFp16);
 
-        // Create a mask to identify the DWORDs that are smaller than the minimum normalized fp16 number
-        __m128 CmpToMinFp16Mask = _mm_cmplt_ps(AbsSrc, FVec4MinNormalFp16);
+            // Shift the mantissa to go from 23 bits to 10 bits
+            Result = _mm_srli_epi32(Result, 13);
 
-        // Create a mask to identify the DWORDs that are larger than the maximum normalized fp16 number
-        __m128 CmpToMaxFp16Mask = _mm_cmpgt_ps(AbsSrc, FVec4MaxNormalFp16);
-        __m128i CmpToInfMask = _mm_cmpeq_epi32(TO_M128i(AbsSrc), IVec4InfF32);
-        // Create a mask with the minimum normalized fp16 number in the DWORDs that are smaller than it
-        __m128 MaskOfMinFp16 = _mm_and_ps(CmpToMinFp16Mask, FVec4MinNormalFp16);
+            Result = _mm_sub_epi16(Result, MaskOf2POW10);
 
-        __m128i MaskOf2POW10 = _mm_and_si128(TO_M128i(CmpToMinFp16Mask), IVec4OnePow10);
-        __m128 ResultPS = _mm_add_ps(AbsSrc, MaskOfMinFp16);
-        __m128i Result = TO_M128i(ResultPS);
+            ResultPS = _mm_blendv_ps(TO_M128(Result), FVec4MaxFp16InWords, CmpToMaxFp16Mask);
+            Result = TO_M128i(ResultPS);
+            //infinity preserving blending
+            Result = _mm_blendv_epi8(Result, IVec4InfF16, CmpToInfMask);
+            // NaNs are quieted and keep the upper bits of their payload, the same as in the F16C conversion
+            __m128i CmpToNanMask = _mm_castps_si128(_mm_cmpunord_ps(Src, Src));
+            __m128i QuietNans = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(TO_M128i(AbsSrc), 13), IVec4MantissaF16), IVec4QNanF16);
+            Result = _mm_blendv_epi8(Result, QuietNans, CmpToNanMask);
 
-        // We need to move from a 127 biased domain to a 15 biased domain. This means subtracting 112 from the exponent. We will add '-112'
-        // to the exponent but since the exponent is shifted 23 bits to the left we need to shift '-112' 23 bits to the left as well.
-        // This gives us 0xC8000000. We are going to shift the mantissa 13 bits to the right (moving from 23 bits mantissa to 10).
-        Result = _mm_add_epi32(Result, IVec4ExpBiasFp16);
+            __m128i iPackedResult = _mm_packs_epi32(Result, Result);
 
-        // Shift the mantissa to go from 23 bits to 10 bits
-        Result = _mm_srli_epi32(Result, 13);
+            // iSignMask = mask of the sign bits of the source 4 dwords
+            __m128i iSignMask = _mm_and_si128(TO_M128i(Src), IVec4SignMask);
 
-        Result = _mm_sub_epi16(Result, MaskOf2POW10);
+            // Pack the sign mask to 4 words
+            __m128i iSignInWords = _mm_packs_epi32(iSignMask, iSignMask);
 
-        ResultPS = _mm_blendv_ps(TO_M128(Result), FVec4MaxFp16InWords, CmpToMaxFp16Mask);
-        Result = TO_M128i(ResultPS);
-        //infinity preserving blending
-        Result = _mm_blendv_epi8(Result, IVec4InfF16, CmpToInfMask);
+            return _mm_or_si128(iPackedResult, iSignInWords);
 
-        __m128i iPackedResult = _mm_packs_epi32(Result, Result);
+#undef TO_M128i
+#undef TO_M128
+        }
 
-        // iSignMask = mask of the sign bits of the source 4 dwords
-        __m128i iSignMask = _mm_and_si128(TO_M128i(Src), IVec4SignMask);
+        // F16C instructions (conversions of 8 values) need AVX state support of the OS as well
+        bool cpu_supports_f16c()
+        {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            const bool f16c = (info[2] & (1 << 29)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            return f16c && avx && osxsave && (_xgetbv(0) & 0x6) == 0x6;
+#else
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+                return false;
+            return (ecx & bit_F16C) != 0 && __builtin_cpu_supports("avx");
+#endif
+        }
 
-        // Pack the sign mask to 4 words
-        __m128i iSignInWords = _mm_packs_epi32(iSignMask, iSignMask);
+        const bool use_f16c = cpu_supports_f16c();
 
-        iPackedResult = _mm_or_si128(iPackedResult, iSignInWords);
-        return (uint16_t)_mm_extract_epi16(iPackedResult, 0);
+        // Rounding towards zero gives the same results as the SSE conversion (truncated mantissa, the largest half
+        // for values out of range, quiet NaNs with truncated payload) except for half subnormals, which the SSE
+        // conversion rounds to nearest, so groups with such values are converted by it.
+        CLDNN_TARGET_F16C size_t float_to_half_f16c(const float* src, uint16_t* dst, size_t count)
+        {
+            const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+            const __m256 min_normal = _mm256_set1_ps(6.103515625e-05f);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256 values = _mm256_loadu_ps(src + i);
+                __m256 abs_values = _mm256_andnot_ps(sign_mask, values);
+                __m256 subnormals = _mm256_and_ps(_mm256_cmp_ps(abs_values, min_normal, _CMP_LT_OQ),
+                                                  _mm256_cmp_ps(abs_values, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+                if (_mm256_movemask_ps(subnormals) != 0)
+                {
+                    __m128i low = float_to_half4(_mm_loadu_ps(src + i));
+                    __m128i high = float_to_half4(_mm_loadu_ps(src + i + 4));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(low, high));
+                    continue;
+                }
+                __m128i halves = _mm256_cvtps_ph(values, _MM_FROUND_TO_ZERO);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), halves);
+            }
+            return i;
+        }
+
+        CLDNN_TARGET_F16C size_t half_to_float_f16c(const uint16_t* src, float* dst, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(halves));
+            }
+            return i;
+        }
+    }
+
+    float half_to_float(uint16_t value)
+    {
+        return _mm_cvtss_f32(half_to_float4(_mm_cvtsi32_si128(value)));
+    }
+
+    uint16_t float_to_half(float value)
+    {
+        return (uint16_t)_mm_extract_epi16(float_to_half4(_mm_set1_ps(value)), 0);
+    }
+
+    void half_to_float(const uint16_t* src, float* dst, size_t count)
+    {
+        size_t i = use_f16c ? half_to_float_f16c(src, dst, count) : 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i halves = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)), _mm_setzero_si128());
+            _mm_storeu_ps(dst + i, half_to_float4(halves));
+        }
+        for (; i < count; i++)
+            dst[i] = half_to_float(src[i]);
+    }
+
+    void float_to_half(const float* src, uint16_t* dst, size_t count)
+    {
+        size_t i = use_f16c ? float_to_half_f16c(src, dst, count) : 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), float_to_half4(_mm_loadu_ps(src + i)));
+        for (; i < count; i++)
+            dst[i] = float_to_half(src[i]);
     }
 }
 
@@ -52,7 +52,9 @@ enum class resource_flags : int
     READ_ONLY =  (1 << 1),
     WRITE_ONLY = (1 << 2),
     DEVICE_ONLY = (1 << 3), // no access from host, fill with data available only on creation
-    COPY_HOST_PTR = (1 << 4) // will copy host pointer data on creation
+    COPY_HOST_PTR = (1 << 4), // will copy host pointer data on creation
+    ALLOC_HOST_PTR = (1 << 5), // host visible memory allocated by the driver, zero-copy on integrated devices
+    USE_HOST_PTR = (1 << 6) // host visible memory allocated by the user, zero-copy on integrated devices
 };
 inline resource_flags operator|(resource_flags a, resource_flags b)
 {
@@ -71,7 +73,9 @@ public:
     engine_types type() const { return engine_types::ocl; }
     refcounted_obj_ptr<memory_impl> allocate_and_copy_memory(refcounted_obj_ptr<memory_impl> to_copy, resource_flags flags = resource_flags::READ_WRITE);
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout);
-    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true);
+    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, uint32_t, const memory_restrictions&, bool reusable = true);
+    // host_ptr - user buffer aligned to page size which is used as the storage (and is not owned by the memory)
+    refcounted_obj_ptr<memory_impl> allocate_host_memory(layout layout, void* host_ptr = nullptr);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, layout new_layout);
     bool is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2);
 
@@ -82,7 +86,7 @@ public:
     refcounted_obj_ptr<program_impl> build_program(const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal); 
     void compile_program(program_impl& prog);
 
-    refcounted_obj_ptr<network_impl> allocate_network(const program_impl& program, bool is_internal = false);
+    refcounted_obj_ptr<network_impl> allocate_network(const program_impl& program, bool is_internal = false, bool is_concurrent = false);
     refcounted_obj_ptr<network_impl> build_network(const topology_impl& topology, const build_options& options, bool is_internal = false);
     refcounted_obj_ptr<network_impl> build_network(const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal);
     void flush_network();
@@ -125,6 +129,7 @@ public:
 
     void dump_memory_pool(const program_impl& program, std::string& path, std::string& dependencies) { _memory_pool.dump_memory_pool(program, path, dependencies); }
     bool use_memory_pool() const;
+    bool use_memory_planner() const { return use_memory_pool() && configuration().enable_memory_planner; }
 
 private:
     engine_configuration _configuration;
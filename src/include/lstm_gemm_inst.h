@@ -31,11 +31,12 @@ public:
 
     program_node& input() const { return get_dependency(0); }
     program_node& weights() const { return get_dependency(1); }
-    program_node& recurrent() const { return get_dependency(2); }
-    program_node& bias() const { return get_dependency(3); }
+    program_node& recurrent() const { return get_dependency(weights_term() ? 2 : 1); }
+    program_node& bias() const { return get_dependency(weights_term() ? 3 : 2); }
     program_node& hidden() const {
-        return bias_term() ? get_dependency(4) : get_dependency(3);
+        return get_dependency((weights_term() ? 3 : 2) + (bias_term() ? 1 : 0));
     }
+    bool weights_term() const { return !get_primitive()->weights.empty(); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
     bool hidden_term() const { return !get_primitive()->hidden.empty(); }
     uint32_t direction() const { return get_primitive()->direction; }
@@ -56,11 +57,12 @@ public:
     typed_primitive_inst(network_impl& network, lstm_gemm_node const& node);
 
     memory_impl& weights_memory() const { return dep_memory(1); }
-    memory_impl& recurrent_memory() const { return dep_memory(2); }
-    memory_impl& bias_memory() const { return dep_memory(3); }
+    memory_impl& recurrent_memory() const { return dep_memory(weights_term() ? 2 : 1); }
+    memory_impl& bias_memory() const { return dep_memory(weights_term() ? 3 : 2); }
     memory_impl& hidden_memory() const {
-        return bias_term() ? dep_memory(4) : dep_memory(3);
+        return dep_memory((weights_term() ? 3 : 2) + (bias_term() ? 1 : 0));
     }
+    bool weights_term() const { return !argument.weights.empty(); }
     bool bias_term() const { return !argument.bias.empty(); }
     bool hidden_term() const { return !argument.hidden.empty(); }
     uint32_t direction() const { return argument.direction; }
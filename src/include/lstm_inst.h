@@ -38,7 +38,7 @@ public:
     }
     program_node& inital_cell() const {
         // This doesn't scale. We should use a map to get the dependencies index at primitive level
-        return get_dependency(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 2));
+        return get_dependency(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 3));
     }
     program_node& peepholes() const { return get_dependency(6); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
@@ -48,6 +48,19 @@ public:
     std::vector<cldnn_activation_func> activations() const { return get_primitive()->activations; }
     std::vector<cldnn_activation_additional_params> activation_params() const { return get_primitive()->activation_params; }
     size_t sequence_len() const { return get_primitive()->get_input().size(); }
+    cldnn_lstm_output output_selection() const { return get_primitive()->output_selection; }
+    cldnn_lstm_offset_order offset_order() const { return get_primitive()->offset_order; }
+    float clip() const { return get_primitive()->clip; }
+    bool input_forget() const { return get_primitive()->input_forget; }
+
+    // input is the projection of the sequence by the weights and the bias: [batch, sequence, direction, 4 * hidden_size]
+    void set_projected_input(uint32_t input_directions) { _projected_input = true; _input_directions = input_directions; }
+    bool projected_input() const { return _projected_input; }
+    uint32_t input_directions() const { return _input_directions; }
+
+private:
+    bool _projected_input = false;
+    uint32_t _input_directions = 1;
 };
 
 using lstm_node = typed_program_node<lstm>;
@@ -72,7 +85,7 @@ public:
         return dep_memory(bias_term() ? 4 : 3);
     }
     memory_impl& initial_cell_memory() const {
-        return dep_memory(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 2));
+        return dep_memory(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 3));
     }
     memory_impl& peepholes_memory() const { return dep_memory(6); }
     bool bias_term() const { return !argument.bias.empty(); }
@@ -40,7 +40,8 @@ struct memory_impl : refcounted_obj<memory_impl>
             _engine->get_memory_pool().subtract_memory_used(_layout.bytes_count());
         }
     }
-    virtual void* lock() = 0;
+    // mode - lets buffers skip the transfer of data which is not read (lock_mode::write) or written (lock_mode::read)
+    virtual void* lock(lock_mode mode = lock_mode::read_write) = 0;
     virtual void unlock() = 0;
     virtual void fill(unsigned char pattern, event_impl::ptr ev) = 0;
     size_t size() const { return _layout.bytes_count(); }
@@ -61,7 +62,7 @@ struct simple_attached_memory : memory_impl
     {
     }
 
-    void* lock() override { return _pointer; }
+    void* lock(lock_mode = lock_mode::read_write) override { return _pointer; }
     void unlock() override {}
     void fill(unsigned char, event_impl::ptr) override {}
 private:
@@ -71,13 +72,13 @@ private:
 template <class T>
 struct mem_lock
 {
-    mem_lock(memory_impl::ptr mem)
-        : mem(mem), ptr(reinterpret_cast<T*>(mem->lock()))
+    mem_lock(memory_impl::ptr mem, lock_mode mode = lock_mode::read_write)
+        : mem(mem), ptr(reinterpret_cast<T*>(mem->lock(mode)))
     {
     }
 
-    mem_lock(memory_impl& mem)
-        : mem_lock(&mem)
+    mem_lock(memory_impl& mem, lock_mode mode = lock_mode::read_write)
+        : mem_lock(&mem, mode)
     {}
 
     ~mem_lock()
@@ -21,6 +21,7 @@
 #include "api_impl.h"
 
 #include "refcounted_obj.h"
+#include "memory_restrictions.h"
 
 #include <vector>
 #include <set>
@@ -41,10 +42,12 @@ enum class resource_flags;
 struct memory_user
 {
     primitive_id _id;
+    uint32_t _memory_index; // program_node::get_memory_index of the user
     uint32_t _network_id;
 
-    memory_user(primitive_id id, uint32_t network_id) :
+    memory_user(primitive_id id, uint32_t memory_index, uint32_t network_id) :
         _id(id) ,
+        _memory_index(memory_index) ,
         _network_id(network_id) 
     {}
 
@@ -69,10 +72,45 @@ struct memory_user_comparer
 struct memory_record
 {
     memory_set _users; // list of primitives that already use this memory object
+    std::map<uint32_t, memory_restrictions> _users_indices; // memory indices of the users grouped by network id
     refcounted_obj_ptr<memory_impl> _memory;
     uint32_t _network_id;
 
     memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id);
+    void add_user(const memory_user& user);
+};
+
+// single buffer to be placed by the memory planner
+struct memory_plan_request
+{
+    primitive_id _id;
+    uint64_t _size;
+    std::vector<size_t> _conflicts; // indices of requests which can't share memory with this one
+
+    memory_plan_request(primitive_id id, uint64_t size) :
+        _id(id),
+        _size(size)
+    {}
+};
+
+// result of the static memory planning - each request is placed in one of arenas at given offset,
+// requests bigger than the arena size limit are not planned
+struct memory_plan
+{
+    static const size_t unplanned = static_cast<size_t>(-1);
+
+    struct placement
+    {
+        size_t _arena;                  // unplanned if the request doesn't fit into an arena
+        uint64_t _offset;
+        uint64_t _size;
+    };
+
+    std::vector<uint64_t> _arenas;      // size of each arena
+    std::vector<placement> _placements; // placement of each request (same order as requests)
+    uint64_t _naive_size = 0;           // memory needed when every planned request gets its own buffer
+
+    uint64_t get_planned_size() const;
 };
 
 struct padded_pool_comparer
@@ -98,10 +136,27 @@ struct padded_pool_comparer
     //     3   * yes: check if any of current users exist on request conflict list if no - return this memory, otherwise goto 4
     //         * no: goto 4
     //     4 take next (allocations are sorted in increasing order) allocation. if there is no more allocations, create new allocation otherwise go t
-    // - padded buffers - not implemented yet
-    // - images 2d - not implemented yet
+    // - padded buffers - 
+    //     1 user requests for buffer with padding.
+    //     2 records are grouped by format, data type, spatial sizes and padding (padded_pool_comparer), so padding regions
+    //       of all users of one record stay at the same places and keep their zeros
+    //     3 the smallest record of the group which is big enough (by total byte size if only spatial dims are padded,
+    //       by feature and batch sizes otherwise) and has no conflicting users is returned, otherwise new allocation is created
+    //   new non padded buffers are not cleared (reused ones aren't either), new padded buffers are filled with zeros
+    // - images 2d - the same as non padded buffers, but memory can be reused only by image of the same format and data type
+    //     which fits in the image width and height
     // - images 2d arrays - not implemented yet
     // - immutable - if user request for non reusable resource don't use pool, return 
+    //
+    // optionally (engine_configuration::enable_memory_planner) buffers of the whole network are planned up front:
+    //     1 live range of each buffer is computed from processing order (extended through optimized out users),
+    //       buffers conflict when their live ranges overlap or when they are on each other restriction list
+    //     2 buffers are placed greedy-by-size at best-fit offsets within a small number of large arenas
+    //     3 get_memory returns sub-buffers of arenas for planned primitives, other requests go to the pools above
+//
+// buffers are shared between networks, which are expected to be executed one after another. Networks which run
+// concurrently with others (requests of pipeline_impl) are registered by add_concurrent_network - their buffers are
+// not shared with any other network and they are not planned (arenas are shared between networks too)
 
 // TODO list:
 // - resolve engine <--> memory_pool circular dependency
@@ -113,30 +168,49 @@ class memory_pool
 {
     memory_pool();
     
-    refcounted_obj_ptr<memory_impl> alloc_memory(const layout& layout, resource_flags flags, refcounted_obj_ptr<memory_impl> to_copy = nullptr);
-    static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t);
+    // reset - new buffer is filled with zeros, needed for user memory and padded buffers, which are expected to have zero padding
+    // host_ptr - storage of the buffer for resource_flags::USE_HOST_PTR
+    refcounted_obj_ptr<memory_impl> alloc_memory(const layout& layout, resource_flags flags, refcounted_obj_ptr<memory_impl> to_copy = nullptr, bool reset = true, void* host_ptr = nullptr);
+    bool has_conflict(const memory_record&, const memory_restrictions&, uint32_t) const;
+    static bool is_compatible(const memory_impl& memory, const layout& layout);
+    void release_records(size_t records_count);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout,std::list<memory_record>, padded_pool_comparer> _padded_pool;
     std::multimap<uint64_t, memory_record> _no_reusable_pool;
+    std::multimap<uint64_t, memory_record> _image2d_pool;
+    std::vector<refcounted_obj_ptr<memory_impl>> _arenas;
+    std::map<std::pair<uint32_t, uint32_t>, std::pair<refcounted_obj_ptr<memory_impl>, memory_plan::placement>> _planned; // keyed by network id and memory index
+    uint64_t _planned_memory_size;
+    uint64_t _naive_memory_size;
     refcounted_obj_ptr<engine_impl> _engine;
     uint64_t _temp_memory_used;
     uint64_t _max_peak_memory_used;
+    std::set<uint32_t> _concurrent_networks;
 public:
     memory_pool(engine_impl& engine);
     ~memory_pool();
-    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t network_id,  const std::set<primitive_id>& restrictions, bool reusable = true); // get from pool or create memory allocation
-    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout);
+    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions, bool reusable = true); // get from pool or create memory allocation
+    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, bool reset = true);
+    refcounted_obj_ptr<memory_impl> get_host_memory(const layout& layout, void* host_ptr = nullptr); // zero-copy host visible memory, never pooled
     refcounted_obj_ptr<memory_impl> alloc_and_copy_memory(refcounted_obj_ptr<memory_impl> src, resource_flags flags);
-    refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>&);
-    refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions);
-    refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id);
+    refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions);
+    refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions);
+    refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id);
+    refcounted_obj_ptr<memory_impl> get_from_image2d_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions);
+    refcounted_obj_ptr<memory_impl> get_from_memory_plan(const layout& layout, uint32_t memory_index, uint32_t network_id);
+    void plan_memory(const program_impl& program, uint32_t network_id);
+    void add_concurrent_network(uint32_t network_id) { _concurrent_networks.insert(network_id); }
+    bool is_concurrent_network(uint32_t network_id) const { return _concurrent_networks.count(network_id) != 0; }
+    static memory_plan make_memory_plan(const std::vector<memory_plan_request>& requests, uint64_t alignment, uint64_t max_arena_size);
     void clear_pool();
     void color_graph(const program_impl&);
     void dump_memory_pool(const program_impl&, std::string&, std::string&);
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; };
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; };
+    uint64_t get_planned_memory_size() const { return _planned_memory_size; };
+    uint64_t get_naive_memory_size() const { return _naive_memory_size; };
     void add_memory_used(size_t value);
     void subtract_memory_used(size_t value);
 };
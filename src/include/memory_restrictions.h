@@ -0,0 +1,105 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cldnn
+{
+
+// Set of dense node indices (program_node::get_memory_index) stored as a bitset.
+// Memory dependencies of nodes and users of memory pool records are kept in this form,
+// so checking whether a buffer can be shared is a word-wise AND of two sets.
+class memory_restrictions
+{
+    using word_type = uint64_t;
+    static constexpr uint32_t bits_per_word = 64;
+
+public:
+    void insert(uint32_t idx)
+    {
+        auto word = idx / bits_per_word;
+        if (word >= _words.size())
+            _words.resize(word + 1, 0);
+        _words[word] |= word_type(1) << (idx % bits_per_word);
+    }
+
+    void insert(const memory_restrictions& other)
+    {
+        if (other._words.size() > _words.size())
+            _words.resize(other._words.size(), 0);
+        for (size_t i = 0; i < other._words.size(); ++i)
+            _words[i] |= other._words[i];
+    }
+
+    bool contains(uint32_t idx) const
+    {
+        auto word = idx / bits_per_word;
+        return word < _words.size() && (_words[word] & (word_type(1) << (idx % bits_per_word))) != 0;
+    }
+
+    bool intersects(const memory_restrictions& other) const
+    {
+        auto words = std::min(_words.size(), other._words.size());
+        for (size_t i = 0; i < words; ++i)
+        {
+            if (_words[i] & other._words[i])
+                return true;
+        }
+        return false;
+    }
+
+    // true if every index of other is in the set
+    bool includes(const memory_restrictions& other) const
+    {
+        for (size_t i = 0; i < other._words.size(); ++i)
+        {
+            auto word = i < _words.size() ? _words[i] : 0;
+            if ((other._words[i] & ~word) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    bool empty() const
+    {
+        return std::all_of(_words.begin(), _words.end(), [](word_type word) { return word == 0; });
+    }
+
+    // calls func for each index in the set in increasing order
+    template <class Func>
+    void for_each(Func func) const
+    {
+        for (size_t i = 0; i < _words.size(); ++i)
+        {
+            auto word = _words[i];
+            for (uint32_t bit = 0; word != 0; ++bit, word >>= 1)
+            {
+                if (word & 1)
+                    func(static_cast<uint32_t>(i * bits_per_word + bit));
+            }
+        }
+    }
+
+private:
+    std::vector<word_type> _words;
+};
+
+}
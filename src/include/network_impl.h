@@ -26,6 +26,7 @@
 #include "refcounted_obj.h"
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -34,19 +35,26 @@ namespace cldnn
 
 class primitive_inst;
 
+namespace gpu {
+class events_owner;
+}
+
 struct network_impl : public refcounted_obj<network_impl>
 {
 public:
-    network_impl(const program_impl& program, bool is_internal = false);
+    // is_concurrent - the network may run at the same time as other networks, so it doesn't share buffers with them
+    network_impl(const program_impl& program, bool is_internal = false, bool is_concurrent = false);
     network_impl(engine_impl& engine, const topology_impl& topo, const build_options& options = build_options(), bool is_internal = false);
     network_impl(engine_impl& engine, const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal);
     network_impl(engine_impl& engine, const std::string& file_name, const std::string& dump_path = "");
+    ~network_impl();
 
     const program_impl& get_program() const { return *_program; }
     engine_impl& get_engine() const { return _program->get_engine(); }
 
     void reset_execution(bool wait = true);
     void set_input_data(const primitive_id& id, memory_impl& data);
+    void set_output_memory(const primitive_id& id, memory_impl& mem);
 
     void set_learning_rate(const float lr);
     float get_learning_rate();
@@ -67,14 +75,14 @@ public:
     // Implementation specific calls
     std::shared_ptr<primitive_inst> get_primitive(const primitive_id& id);
     std::string get_primitive_info(const primitive_id& id) const;
-    const event_impl::ptr& get_primitive_event(const primitive_id& id) const { return _events.at(id); }
+    const event_impl::ptr& get_primitive_event(const primitive_id& id) const;
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<primitive_id>& ids);
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<program_node*>& nodes);
-    void execute_primitive(const std::shared_ptr<primitive_inst>& primitive, const std::vector<event_impl::ptr>& events);
     void allocate_primitives();
     void build_insts_deps();
     uint32_t get_id() const { return net_id; }
-    void build_exec_order();    
+    void build_exec_order();
+    void build_exec_plan();
     bool is_internal() const { return _internal; }
 private:
     uint32_t net_id = 0; 
@@ -88,10 +96,27 @@ private:
     std::list<std::shared_ptr<primitive_inst>> _exec_order;
     std::list<std::shared_ptr<primitive_inst>> _data_outputs;
 
-    std::unordered_map<primitive_id, event_impl::ptr> _events;
+    // Execution plan built once by build_exec_plan. Events of executed primitives are stored in _events at fixed slots
+    // and dependencies of each step are resolved by slot indices, so execute() doesn't look anything up by primitive id.
+    struct exec_step
+    {
+        std::shared_ptr<primitive_inst> inst;
+        std::vector<size_t> deps; // event slots of inst exec dependencies
+        bool skipped;             // not executed in single kernel mode, gets set user event instead
+        uint16_t queue;           // command queue selected by the queue scheduler (used only with several queues)
+    };
+    std::vector<exec_step> _exec_plan;                    // step i writes its event to slot i
+    bool _multi_queue = false;                            // steps of the plan are distributed over several command queues
+    std::vector<std::pair<size_t, size_t>> _events_aliases; // (mutable_data slot, slot of its event source), applied after execution
+    std::vector<size_t> _data_outputs_slots;
+    std::unordered_map<primitive_id, size_t> _events_slots;
+    std::vector<event_impl::ptr> _events;
+    std::vector<event_impl::ptr> _deps_events; // scratch for dependency events of single step
+    std::unique_ptr<gpu::events_owner> _events_owner; // events acquired during execution, reset when it ends
 
     void allocate_primitive_instance(program_node const& node);
     void add_to_exec_order(const primitive_id& id);
+    event_impl::ptr execute_step(const exec_step& step, const std::vector<event_impl::ptr>& events);
     std::shared_ptr<primitive_inst> find_in_internal_networks(const primitive_id& id);
     std::shared_ptr<primitive_inst> find_primitive(const primitive_id& id);
     void check_names();
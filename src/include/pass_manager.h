@@ -18,6 +18,7 @@
 
 #include "program_impl.h"
 #include "layout_optimizer.h"
+#include "lstm_inst.h"
 
 namespace cldnn
 {
@@ -122,6 +123,9 @@ namespace cldnn
         void replace_nodes(program_impl& p);
         void handle_detection_output(program_impl& p);
         void handle_lstm(program_impl& p);
+        bool fuse_lstm_sequence(program_impl& p, lstm_node& node);
+        program_node& add_lstm_input_projection(program_impl& p, program_node& sequence_input, size_t sequence_len, const primitive_id& projection_id,
+                                                const primitive_id& weights_id, const primitive_id& recurrent_id, const primitive_id& bias_id, size_t dir);
         void set_outputs(program_impl& p);  
     };
 
@@ -159,6 +163,14 @@ namespace cldnn
         virtual void run(program_impl& p) override;
     };
 
+    class prepare_in_place_execution : public base_pass
+    {
+    public:
+        prepare_in_place_execution() : base_pass("prepare_in_place_execution") {}
+    private:
+        virtual void run(program_impl& p) override;
+    };
+
     class prepare_conv_eltw_fusing : public base_pass
     {
     public:
@@ -0,0 +1,91 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "api_impl.h"
+#include "memory_impl.h"
+#include "network_impl.h"
+#include "program_impl.h"
+#include "refcounted_obj.h"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cldnn
+{
+
+// Executes requests of one program concurrently. Every request slot is a network allocated from the program, which
+// doesn't share its buffers with other networks (see memory_pool::add_concurrent_network), with device buffers
+// attached to its inputs. Slots are used round-robin, submit blocks while the next slot is still in flight.
+//
+// Request stages:
+//     1 upload - inputs are copied from host memory to the input buffers of the slot on the transfer queue
+//       (gpu_toolkit::transfer_queue), so they overlap execution of previous requests; submit returns when
+//       the copies are done, so the host memory can be reused right away
+//     2 execution - the network of the slot is enqueued the same way as network_impl::execute
+//     3 download - outputs are copied to host memory on the transfer queue after the execution, while
+//       following requests are executed
+// The handler is called from a worker thread (gpu_toolkit::get_host_tasks) when the outputs are in host memory.
+struct pipeline_impl : public refcounted_obj<pipeline_impl>
+{
+public:
+    // status is CLDNN_SUCCESS if the outputs were copied, error otherwise
+    using completion_handler = std::function<void(cldnn_status)>;
+
+    pipeline_impl(const program_impl& program, uint32_t requests_count);
+    ~pipeline_impl();
+
+    const program_impl& get_program() const { return *_program; }
+    engine_impl& get_engine() const { return _program->get_engine(); }
+    uint32_t get_requests_count() const { return static_cast<uint32_t>(_requests.size()); }
+    // layout of input_layout or output primitive, host memory of inputs and outputs has its byte size
+    layout get_layout(const primitive_id& id) const;
+
+    void submit(const std::vector<std::pair<primitive_id, const void*>>& inputs,
+                const std::vector<std::pair<primitive_id, void*>>& outputs,
+                completion_handler handler);
+    // waits until all submitted requests are finished and their handlers returned
+    void wait();
+
+private:
+    struct request
+    {
+        network_impl::ptr network;
+        std::vector<std::pair<primitive_id, memory_impl::ptr>> inputs; // buffers attached to input_layout primitives
+        bool busy = false;
+        completion_handler handler;
+    };
+
+    const program_impl::cptr _program;
+    std::vector<std::unique_ptr<request>> _requests;
+    size_t _next_request = 0;
+    size_t _pending = 0;                    // submitted requests whose handlers didn't return yet
+    std::mutex _submit_mutex;               // requests are enqueued one by one
+    std::mutex _state_mutex;                // guards busy flags and _pending
+    std::condition_variable _request_finished;
+
+    void finish(request& req, cldnn_status status);
+    void cancel(request& req);
+};
+}
+
+API_CAST(::cldnn_pipeline, cldnn::pipeline_impl)
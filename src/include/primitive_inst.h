@@ -85,6 +85,11 @@ public:
         return reinterpret_cast<std::vector<std::shared_ptr<const primitive_inst>> const&>(_deps);
     }
 
+    const std::vector<std::shared_ptr<const primitive_inst>>& exec_dependencies() const
+    {
+        return reinterpret_cast<std::vector<std::shared_ptr<const primitive_inst>> const&>(_exec_deps);
+    }
+
     memory_impl& dep_memory(size_t index) const { return dependencies().at(index)->output_memory(); }
     memory_impl& output_memory() const { return *_output; }
     size_t inputs_memory_count() const { return _node.get_primitive()->get_input().size(); }
@@ -106,10 +111,15 @@ public:
         return dep_memory(index); 
     }
 
+    // events - events of exec dependencies in the same order as exec_dependencies() (resolved by network_impl execution plan),
+    // or events provided by the user if primitive has no exec dependencies
     event_impl::ptr execute(const std::vector<event_impl::ptr>& events);
     bool validate() const { return _impl->validate(*this); }
     bool output_changed() const { return _output_changed; }
     void reset_output_change() { _output_changed = false; }
+    // Attaches memory owned by someone else as the output, so the primitive writes its result directly there. Returns false
+    // if the output is shared with other primitives (inputs, data, optimized out and in-place primitives and their users) or the layout differs.
+    bool set_output_memory(memory_impl& mem);
 
     void build_deps();
 
@@ -135,7 +145,7 @@ protected:
     // depending on reshape_node.is_in_place())
     memory_impl::ptr _output;
 
-    bool _output_changed; //todo: implement output reuse if neither of inputs has changed
+    bool _output_changed; //set when a new buffer is attached as output, gpu impls bind kernel arguments again for such instance and its users
     bool _has_valid_input = true; //by default all primitives has valid inputs, exception is input_layout (see input_layout_inst)
 
     memory_impl::ptr allocate_output();
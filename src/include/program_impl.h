@@ -25,6 +25,11 @@
 
 #include <list>
 
+namespace kernel_selector
+{
+    class KernelSelectionCache;
+}
+
 namespace cldnn
 {
 
@@ -105,6 +110,8 @@ public:
     ~program_impl();
     engine_impl& get_engine() const { return *engine; }
     const build_options& get_options() const { return options; }
+    // kernels selected by previous builds (see build_option::kernel_selection_cache), nullptr if the option is not set
+    const std::shared_ptr<kernel_selector::KernelSelectionCache>& get_kernel_selection_cache() const { return kernel_selection_cache; }
     std::list<program_node*>& get_inputs() { return inputs; }     // ToDo: redesign trim to ouptut pass to make it const as_well as get_engine and get options 
     std::vector<program_node*>& get_outputs() { return outputs; }  // ToDo: redesign reorder-inputs pass to make it const as_well as get_engine and get options 
     bool is_debug_build() const { return options.get<build_option_type::debug>()->enabled(); }
@@ -114,6 +121,7 @@ public:
     bool has_node(const primitive_id& prim) const { return nodes_map.count(prim) > 0; }
     program_node& get_node(primitive_id const& id);
     program_node const& get_node(primitive_id const& id) const;
+    program_node const& get_node_by_memory_index(uint32_t index) const { return *memory_indexed_nodes.at(index); }
     std::shared_ptr<program_node> get_node_ptr(const primitive_id& prim) { return nodes_map.at(prim);  }
     std::shared_ptr<program_node> get_node_ptr(const primitive_id& prim) const { return nodes_map.at(prim); }
     void dump_memory_pool() const;
@@ -161,9 +169,11 @@ private:
     uint32_t prog_id = 0;
     engine_impl::ptr engine;
     build_options options;
+    std::shared_ptr<kernel_selector::KernelSelectionCache> kernel_selection_cache;
     std::list<program_node*> inputs;
     std::vector<program_node*> outputs;
     nodes_ordering processing_order;
+    std::vector<program_node*> memory_indexed_nodes; // nodes by their memory index, see prepare_memory_dependencies
     std::unique_ptr<pass_manager> pm;
 
     std::map<primitive_id, std::shared_ptr<program_node>> nodes_map;
@@ -206,6 +216,7 @@ private:
     void basic_memory_dependencies();
     void skipped_branch_memory_dependencies();
     void oooq_memory_dependencies();
+    void multi_queue_memory_dependencies();
     std::string get_memory_dependencies_string() const;
 
     /*
@@ -21,6 +21,7 @@
 #include "internal_primitive.h"
 
 #include "meta_utils.h"
+#include "memory_restrictions.h"
 
 #define GCC_VERSION (__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__)
 
@@ -102,8 +103,13 @@ public:
     void remove_dependency(program_node& node);
 
     std::set<primitive_id> get_memory_dependencies() const;
-    void add_memory_dependency(primitive_id);
-    void add_memory_dependency(std::vector<primitive_id>);
+    const memory_restrictions& get_memory_restrictions() const { return memory_dependencies; }
+    void add_memory_dependency(uint32_t memory_index);
+    void add_memory_dependency(const memory_restrictions& restrictions);
+
+    // dense index of the node assigned by program_impl::prepare_memory_dependencies (position in processing order)
+    uint32_t get_memory_index() const { return memory_index; }
+    void set_memory_index(uint32_t index) { memory_index = index; }
 
     template<class PType>
     bool have_user_with_type() const
@@ -198,6 +204,11 @@ public:
     bool can_share_buffer() const { return share_buffer; }
     void can_share_buffer(bool share) { share_buffer = share; }
 
+    // check/set the dependency whose buffer is reused as the output of the node (the node is executed in-place),
+    // nullptr if the node has its own output buffer
+    program_node* get_in_place_input() const { return in_place_input; }
+    void set_in_place_input(program_node* input) { in_place_input = input; }
+
     // check/set if the node support padding in x,y,b and f
     bool support_padding() const { return _support_padding; }
     void support_padding(bool support) { _support_padding = support; }
@@ -261,8 +272,9 @@ protected:
     std::vector<program_node*> dependencies;
     std::list<program_node*> users;
 
-    // list of primitives that can reuse same memory buffers due to execution order conflicts
-    std::set<primitive_id> memory_dependencies;
+    // indices of primitives that can't reuse same memory buffers due to execution order conflicts
+    memory_restrictions memory_dependencies;
+    uint32_t memory_index = 0;
 
     bool constant = false;
     bool data_flow = false;
@@ -272,6 +284,7 @@ protected:
     bool optimized = false;
     bool share_buffer = true;
     bool _support_padding = false;
+    program_node* in_place_input = nullptr;
 
     mutable bool has_reused_memory = false;
     mutable uint32_t reused_memory_color = 0;
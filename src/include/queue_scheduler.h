@@ -0,0 +1,65 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cldnn
+{
+
+// single step of the execution plan to be assigned to a command queue
+struct queue_schedule_request
+{
+    uint64_t _cost;             // estimated execution time (any unit, the same for all requests)
+    std::vector<size_t> _deps;  // indices of earlier requests which have to be finished before this one starts
+
+    queue_schedule_request(uint64_t cost, std::vector<size_t> deps = {}) :
+        _cost(cost),
+        _deps(std::move(deps))
+    {}
+};
+
+// assignment of the requests to in-order queues and its simulated execution
+struct queue_schedule
+{
+    std::vector<uint16_t> _queues;      // queue of each request (same order as requests)
+    uint64_t _makespan = 0;             // time when the last request finishes
+    uint64_t _serial_time = 0;          // time of execution on a single queue (sum of costs)
+    size_t _cross_queue_waits = 0;      // dependencies on requests from other queues, each one is an event wait
+};
+
+// Requests are enqueued in the given order (processing order of the network), each queue executes its requests in
+// that order. A request starts when its queue is free and its dependencies are finished, dependencies from other
+// queues are waited for through events, which delays the request by sync_cost. Dependencies from the same queue are
+// ordered by the queue itself and cost nothing.
+//
+// make_queue_schedule does list scheduling over the requests:
+//     1 bottom level of each request (its cost plus the longest chain of costs of its users) is computed, the user with
+//       the highest bottom level is the critical user of a request
+//     2 each request goes to the queue on which it starts earliest, the critical user of a request reserves the queue
+//       of the request, so other requests which would start on that queue pay as if they delayed the critical path
+//     3 ties go to the queue reserved for the request, then to free queues, then to the lower queue index
+// so chains stay on one queue without any synchronization and independent branches are spread over other queues.
+queue_schedule make_queue_schedule(const std::vector<queue_schedule_request>& requests, uint16_t queues_count, uint64_t sync_cost);
+
+// computes makespan and cross-queue waits of given assignment
+queue_schedule simulate_queue_schedule(const std::vector<queue_schedule_request>& requests, std::vector<uint16_t> queues, uint64_t sync_cost);
+
+}
@@ -52,8 +52,8 @@ void input_layout_inst::set_data(memory_impl& mem)
     }
     else
     {
-        mem_lock<char> src(&mem);
-        mem_lock<char> dst(_output);
+        mem_lock<char> src(&mem, lock_mode::read);
+        mem_lock<char> dst(_output, lock_mode::write);
         std::copy(src.begin(), src.end(), dst.begin());
     }
 
@@ -215,6 +215,7 @@ kernel_selector::tuning_mode to_tuning_mode(cldnn::tuning_mode mode)
     case cldnn::tuning_mode::tuning_disabled:         return kernel_selector::tuning_mode::TUNING_DISABLED;
     case cldnn::tuning_mode::tuning_use_cache:        return kernel_selector::tuning_mode::TUNING_USE_CACHE;
     case cldnn::tuning_mode::tuning_tune_and_cache:   return kernel_selector::tuning_mode::TUNING_TUNE_AND_CACHE;
+    case cldnn::tuning_mode::tuning_cost_model:       return kernel_selector::tuning_mode::TUNING_COST_MODEL;
     default:
         return kernel_selector::tuning_mode::TUNING_DISABLED;
     }
@@ -410,6 +411,7 @@ void set_params(const program_node& node, kernel_selector::params& params)
     params.engineInfo.deviceId = engine_info.dev_id;
     params.engineInfo.computeUnitsCount = engine_info.compute_units_count;
     params.engineInfo.deviceCache = engine_info.device_cache;
+    params.engineInfo.deviceBinaryCache = engine_info.device_binary_cache;
     params.engineInfo.driverVersion = engine_info.driver_version;
     params.engineInfo.hostVersion = to_host_version(cldnn::get_version());
 }
@@ -439,4 +441,5 @@ void set_optional_params(const program_impl& program, kernel_selector::optional_
     const auto& tuning_config = program.get_options().get<build_option_type::tuning_config>();
     params.tuningParams.mode = to_tuning_mode(tuning_config->config.mode);
     params.tuningParams.cacheFilePath = tuning_config->config.cache_file_path;
+    params.selectionCache = program.get_kernel_selection_cache();
 }
\ No newline at end of file
@@ -34,7 +34,8 @@ layout lstm_inst::calc_output_layout(lstm_node const& node)
     assert((bool)node.get_primitive()->get_output_data_type() == false
            && "Output data type forcing is not supported for lstm_node!");
     auto input_layout = node.input().get_output_layout();
-    auto hidden_layout = node.inital_hidden().get_output_layout();
+    auto recurrent_layout = node.recurrent().get_output_layout();
+    auto desc = node.get_primitive();
 
     // input     = [ batch,  sequence,       direction,      input_size ]
     // weights   = [     1, direction, 4 * hidden_size,      input_size ]
@@ -42,10 +43,18 @@ layout lstm_inst::calc_output_layout(lstm_node const& node)
     // biases    = [     1,         1,       direction, 4 * hidden_size ]
     // hidden    = [ batch,         1,       direction,     hidden_size ]
     // cell      = [ batch,         1,       direction,     hidden_size ]
-    // output    = [ batch,  sequence,       direction,     hidden_size ]
-	auto result = layout(input_layout.data_type, format::bfyx,
-                  tensor(hidden_layout.size.feature[0], input_layout.size.feature[0],
-                         hidden_layout.size.spatial[0], hidden_layout.size.spatial[1]));
+    // output    = [ batch,   outputs,       direction,     hidden_size ]
+    // outputs are the hidden states of the whole sequence or of the last step only, followed by the last cell state if requested
+    bool emit_sequence = desc->output_selection == cldnn_lstm_output_sequence ||
+        desc->output_selection == cldnn_lstm_output_sequence_cell;
+    bool emit_last_cell = desc->output_selection == cldnn_lstm_output_hidden_cell ||
+        desc->output_selection == cldnn_lstm_output_sequence_cell;
+    auto sequence_len = node.sequence_len() > 1 ? static_cast<tensor::value_type>(node.sequence_len()) : input_layout.size.feature[0];
+    auto outputs = (emit_sequence ? sequence_len : 1) + (emit_last_cell ? 1 : 0);
+
+    auto result = layout(input_layout.data_type, format::bfyx,
+                  tensor(input_layout.size.batch[0], outputs,
+                         recurrent_layout.size.spatial[0], recurrent_layout.size.feature[0]));
     return result;
 }
 
@@ -35,15 +35,16 @@ layout lstm_gemm_inst::calc_output_layout(lstm_gemm_node const& node)
            && "Output data type forcing is not supported for lstm_gemm_node!");
     auto desc = node.get_primitive();
     auto input_layout = node.input().get_output_layout();
-    auto weights_layout = node.weights().get_output_layout();
+    // recurrent has the same direction and gates sizes as the weights, which are not present for projected input
+    auto recurrent_layout = node.recurrent().get_output_layout();
 
-    //   input{bfyx}     = [b: batch, f: sequence,   x: input_size,      y: 1]
+    //   input{bfyx}     = [b: batch, f: sequence,   x: input_size,      y: 1] or [b: batch, f: 1, x: 4 * hidden_size, y: 1] if projected
     //   weights{bfyx}   = [b: 1,     f: direction,  x: 4 * hidden_size, y: input_size ]
     //   recurrent{bfyx} = [b: 1,     f: direction,  x: 4 * hidden_size, y: hidden_size ]
     //   biases{bfyx}    = [b: 1,     f:1 ,          x: direction,       y:  4 * hidden_size ]
     //   hidden{bfyx}    = [b: batch, f:  direction, x: 1 ,              y: hidden_size ] optional
     //   tempGEMM{bfyx}  = [b: batch, f: direction,  x: 4*hidden_size,   y: 1] output
-    auto result = layout(input_layout.data_type, input_layout.format, tensor(input_layout.size.batch[0], weights_layout.size.feature[0], weights_layout.size.spatial[1], 1));
+    auto result = layout(input_layout.data_type, input_layout.format, tensor(input_layout.size.batch[0], recurrent_layout.size.feature[0], recurrent_layout.size.spatial[1], 1));
     return result;
 }
 
@@ -51,7 +52,7 @@ std::string lstm_gemm_inst::to_string(lstm_gemm_node const& node)
 {
     auto desc         = node.get_primitive();
     auto node_info    = node.desc_to_json();
-    auto weights_id   = desc->weights;
+    auto weights_id   = desc->weights != "" ? desc->weights : "no weights (projected input)";
     auto recurrent_id = desc->recurrent;
     auto bias_id      = desc->bias != "" ? desc->bias : "no bias";
     auto hidden_id    = desc->hidden != "" ? desc->hidden : "no inital hidden";
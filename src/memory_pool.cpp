@@ -18,6 +18,7 @@
 
 #include <algorithm> 
 #include <fstream>
+#include <limits>
 
 #include "memory_pool.h"
 #include "engine_impl.h"
@@ -25,6 +26,9 @@
 #include "program_impl.h"
 
 #include "program_node.h"
+#include "generic_layer.hpp"
+#include "concatenation_inst.h"
+#include "mutable_data_inst.h"
 
 #include "gpu/memory_gpu.h"
 namespace cldnn
@@ -33,9 +37,18 @@ namespace cldnn
         _users(users)
         , _memory(memory)
         , _network_id(net_id)
-    {}
+    {
+        for (const auto& user : _users)
+            _users_indices[user._network_id].insert(user._memory_index);
+    }
+
+    void memory_record::add_user(const memory_user& user)
+    {
+        _users.insert(user);
+        _users_indices[user._network_id].insert(user._memory_index);
+    }
 
-    memory_impl::ptr memory_pool::alloc_memory(const layout& layout, resource_flags flags, memory_impl::ptr to_copy)
+    memory_impl::ptr memory_pool::alloc_memory(const layout& layout, resource_flags flags, memory_impl::ptr to_copy, bool reset, void* host_ptr)
     {
         auto context = _engine->get_context();
         
@@ -59,7 +72,7 @@ namespace cldnn
                 if (to_copy != nullptr)
                     return{ new gpu::gpu_buffer(_engine, flags, static_cast<gpu::gpu_buffer::ptr>(to_copy)), false };
                 else
-                    return{ new gpu::gpu_buffer(_engine, layout), false };
+                    return{ new gpu::gpu_buffer(_engine, layout, flags, host_ptr, reset), false };
             }
         }
         catch (const cl::Error& clErr)
@@ -79,109 +92,412 @@ namespace cldnn
     memory_pool::~memory_pool()
     { }
 
-    bool memory_pool::has_conflict(const memory_set& a, const std::set<primitive_id>& b, uint32_t b_network_id)
-    {   
-        std::set<primitive_id> a_same_network;
-        for (auto const& mem_usr : a)
+    bool memory_pool::has_conflict(const memory_record& record, const memory_restrictions& restrictions, uint32_t network_id) const
+    {
+        // users from the same network conflict by restrictions, users from other networks only if any of the networks is concurrent
+        if (_concurrent_networks.empty())
         {
-            if (mem_usr._network_id == b_network_id)
+            auto users = record._users_indices.find(network_id);
+            return users != record._users_indices.end() && users->second.intersects(restrictions);
+        }
+
+        bool concurrent = is_concurrent_network(network_id);
+        for (const auto& users : record._users_indices)
+        {
+            if (users.first == network_id)
             {
-                a_same_network.insert(mem_usr._id);
+                if (users.second.intersects(restrictions))
+                    return true;
             }
+            else if (concurrent || is_concurrent_network(users.first))
+                return true;
         }
-        std::vector<primitive_id> intersection;
-        intersection.reserve(std::min(a_same_network.size(), b.size()));
-        set_intersection(a_same_network.begin(), a_same_network.end(), b.begin(), b.end(), std::back_inserter(intersection));
-        return !intersection.empty();
+        return false;
     }
 
-    memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    bool memory_pool::is_compatible(const memory_impl& memory, const layout& layout)
+    {
+        const auto& mem_layout = memory.get_layout();
+        if (mem_layout.format.is_image() != layout.format.is_image())
+            return false;
+        if (!layout.format.is_image_2d())
+            return true; // buffers are reused by byte size
+
+        if (mem_layout.format != layout.format || mem_layout.data_type != layout.data_type)
+            return false;
+        auto mem_size = gpu::gpu_image2d::get_image_size(mem_layout);
+        auto size = gpu::gpu_image2d::get_image_size(layout);
+        return size.first <= mem_size.first && size.second <= mem_size.second;
+    }
+
+    memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions)
     {
         auto it = _non_padded_pool.lower_bound(layout.bytes_count());
         while (it != _non_padded_pool.end())
         {
-            if (!has_conflict(it->second._users, restrictions, network_id))
+            if (!has_conflict(it->second, restrictions, network_id))
             {
-                it->second._users.insert(memory_user( id, network_id ));
+                it->second.add_user(memory_user(id, memory_index, network_id));
                 auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
                 return ret_mem;
             }
             else
                 ++it;
         }
-        // didn't find anything for you? create new resource
-        auto mem = alloc_memory(layout, resource_flags::READ_WRITE);
+        // didn't find anything for you? create new resource, no need to clear it as reused records aren't cleared either
+        auto mem = alloc_memory(layout, resource_flags::READ_WRITE, nullptr, false);
         {
-            _non_padded_pool.emplace(layout.bytes_count(), memory_record({ {id, network_id } }, mem, network_id));
+            _non_padded_pool.emplace(layout.bytes_count(), memory_record({ { id, memory_index, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
         }
         return mem;
     }
 
-    memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    static bool fits_in_padded_memory(const layout& layout, const cldnn::layout& mem_layout)
+    {
+        // feature and batch are outer to spatial dims in these formats, so with spatial only padding every feature/batch
+        // slice has the same shape and padding regions of a smaller layout are at the same offsets as in the bigger one
+        const auto& padding = layout.data_padding;
+        bool spatial_padding_only = padding.lower_size().feature[0] == 0 && padding.lower_size().batch[0] == 0 &&
+                                    padding.upper_size().feature[0] == 0 && padding.upper_size().batch[0] == 0;
+        if (spatial_padding_only &&
+            (layout.format == format::bfyx || layout.format == format::bfyx_f16 || layout.format == format::fs_b_yx_fsv32))
+        {
+            return layout.bytes_count() <= mem_layout.bytes_count();
+        }
+        return layout.size.feature[0] <= mem_layout.size.feature[0] &&
+               layout.size.batch[0] <= mem_layout.size.batch[0];
+    }
+
+    memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions)
     {
         auto first_level_cache = _padded_pool.find(layout);
         
         if (first_level_cache != _padded_pool.end())
         {
+            // take the smallest record which fits
+            memory_record* best_fit = nullptr;
             for (auto& rec_list : first_level_cache->second)
             {
-                if (layout.size.feature[0] <= rec_list._memory->get_layout().size.feature[0] &&
-                    layout.size.batch[0] <= rec_list._memory->get_layout().size.batch[0] &&
-                    !has_conflict(rec_list._users, restrictions, network_id))
+                if (fits_in_padded_memory(layout, rec_list._memory->get_layout()) &&
+                    (best_fit == nullptr || rec_list._memory->size() < best_fit->_memory->size()) &&
+                    !has_conflict(rec_list, restrictions, network_id))
                 {
-                    rec_list._users.insert({ id, network_id });
-                    auto ret_mem = _engine->reinterpret_buffer(*(rec_list._memory), layout);
-                    return ret_mem;
+                    best_fit = &rec_list;
                 }
             }
+            if (best_fit != nullptr)
+            {
+                best_fit->add_user(memory_user(id, memory_index, network_id));
+                auto ret_mem = _engine->reinterpret_buffer(*(best_fit->_memory), layout);
+                return ret_mem;
+            }
             auto mem = alloc_memory(layout, resource_flags::NONE);
-            first_level_cache->second.emplace_back(memory_record({ { id, network_id } }, mem, network_id));
+            first_level_cache->second.emplace_back(memory_record({ { id, memory_index, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
             return mem;            
         }
         auto mem = alloc_memory(layout, resource_flags::NONE);
-        std::list<memory_record> list = { memory_record({ { id, network_id } },mem, network_id) };
+        std::list<memory_record> list = { memory_record({ { id, memory_index, network_id } },mem, network_id) };
         _padded_pool.emplace(layout, std::move(list));
         // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
         _engine->release();
         return mem;
     }
 
+    memory_impl::ptr memory_pool::get_from_image2d_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions)
+    {
+        auto it = _image2d_pool.lower_bound(layout.bytes_count());
+        while (it != _image2d_pool.end())
+        {
+            if (is_compatible(*it->second._memory, layout) &&
+                !has_conflict(it->second, restrictions, network_id))
+            {
+                it->second.add_user(memory_user(id, memory_index, network_id));
+                auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
+                return ret_mem;
+            }
+            else
+                ++it;
+        }
+        auto mem = alloc_memory(layout, resource_flags::NONE);
+        {
+            _image2d_pool.emplace(layout.bytes_count(), memory_record({ { id, memory_index, network_id } }, mem, network_id));
+            // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
+            _engine->release();
+        }
+        return mem;
+    }
+
     /*
         This is not reusable within one network or it's internal micronetworks. But we can use this memory records between networks.
     */
-    memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id)
+    memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id)
     {
         auto it = _no_reusable_pool.lower_bound(layout.bytes_count());
 
         while (it != _no_reusable_pool.end())
         {
-            if (it->second._network_id != network_id) // don't use non reusable resources within the same network
+            if (it->second._network_id != network_id && // don't use non reusable resources within the same network
+                is_compatible(*it->second._memory, layout))
             {
-                if (!has_conflict(it->second._users, {}, network_id))
+                if (!has_conflict(it->second, {}, network_id))
                 {
-                    it->second._users.insert(memory_user(id, network_id));
+                    it->second.add_user(memory_user(id, memory_index, network_id));
                     auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
                     return ret_mem;
                 }
             }
             ++it;
         }
-        auto mem = alloc_memory(layout, resource_flags::NONE);
+        auto mem = alloc_memory(layout, resource_flags::NONE, nullptr, static_cast<bool>(layout.data_padding));
         {
-            _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, network_id } }, mem, network_id));
+            _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, memory_index, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
         }
         return mem;
     }
 
-    memory_impl::ptr memory_pool::get_memory(const layout& layout)
+    memory_impl::ptr memory_pool::get_from_memory_plan(const layout& layout, uint32_t memory_index, uint32_t network_id)
     {
-        return alloc_memory(layout, resource_flags::NONE, nullptr);
+        auto it = _planned.find(std::make_pair(network_id, memory_index));
+        if (it == _planned.end())
+            return nullptr;
+
+        auto arena = it->second.first;
+        auto placement = it->second.second;
+        _planned.erase(it);
+        if (layout.bytes_count() > placement._size)
+            return nullptr;
+
+        try {
+            cl_buffer_region region = { static_cast<size_t>(placement._offset), layout.bytes_count() };
+            auto& arena_buffer = reinterpret_cast<const gpu::gpu_buffer&>(*arena).get_buffer();
+            auto sub_buffer = arena_buffer.createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region);
+            return{ new gpu::gpu_buffer(_engine, layout, sub_buffer), false };
+        }
+        catch (const cl::Error&)
+        {
+            // driver refused the region (e.g. misaligned offset), primitive will be served by the pools
+            return nullptr;
+        }
+    }
+
+    const size_t memory_plan::unplanned;
+
+    uint64_t memory_plan::get_planned_size() const
+    {
+        uint64_t size = 0;
+        for (auto arena : _arenas)
+            size += arena;
+        return size;
+    }
+
+    memory_plan memory_pool::make_memory_plan(const std::vector<memory_plan_request>& requests, uint64_t alignment, uint64_t max_arena_size)
+    {
+        auto align = [alignment](uint64_t value) { return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value; };
+
+        memory_plan plan;
+        plan._placements.resize(requests.size());
+        std::vector<bool> placed(requests.size(), false);
+
+        // greedy by size - the biggest buffers are placed first, ties are resolved by requests order
+        std::vector<size_t> order(requests.size());
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&requests](size_t l, size_t r) { return requests[l]._size > requests[r]._size; });
+
+        for (auto idx : order)
+        {
+            const auto& request = requests[idx];
+            if (request._size > max_arena_size)
+            {
+                plan._placements[idx] = { memory_plan::unplanned, 0, request._size };
+                continue;
+            }
+            plan._naive_size += request._size;
+
+            // candidate offsets are compared by growth of the arena first and by unused space left in the gap next (best-fit)
+            const auto none = std::numeric_limits<uint64_t>::max();
+            size_t best_arena = plan._arenas.size();
+            uint64_t best_offset = 0;
+            uint64_t best_growth = none;
+            uint64_t best_slack = none;
+            auto consider = [&](size_t arena, uint64_t offset, uint64_t gap_end)
+            {
+                if (offset + request._size > max_arena_size)
+                    return;
+                auto end = offset + request._size;
+                auto growth = end > plan._arenas[arena] ? end - plan._arenas[arena] : 0;
+                auto slack = gap_end > end ? gap_end - end : 0;
+                if (growth < best_growth || (growth == best_growth && slack < best_slack))
+                {
+                    best_arena = arena;
+                    best_offset = offset;
+                    best_growth = growth;
+                    best_slack = slack;
+                }
+            };
+
+            for (size_t arena = 0; arena < plan._arenas.size(); ++arena)
+            {
+                std::vector<std::pair<uint64_t, uint64_t>> busy; // [begin, end) ranges of conflicting buffers already placed in this arena
+                for (auto conflict : request._conflicts)
+                {
+                    const auto& other = plan._placements[conflict];
+                    if (placed[conflict] && other._arena == arena)
+                        busy.emplace_back(other._offset, other._offset + other._size);
+                }
+                std::sort(busy.begin(), busy.end());
+
+                uint64_t offset = 0;
+                for (const auto& range : busy)
+                {
+                    if (range.first >= offset + request._size)
+                        consider(arena, offset, range.first);
+                    offset = std::max(offset, align(range.second));
+                }
+                consider(arena, offset, std::max(offset, plan._arenas[arena]));
+            }
+
+            if (best_arena == plan._arenas.size())
+                plan._arenas.push_back(0);
+
+            plan._placements[idx] = { best_arena, best_offset, request._size };
+            plan._arenas[best_arena] = std::max(plan._arenas[best_arena], best_offset + request._size);
+            placed[idx] = true;
+        }
+        return plan;
+    }
+
+    static bool is_memory_planned(const program_node& node)
+    {
+        // the same conditions as in primitive_inst::allocate_output - only reusable buffers are planned
+        if (!node.can_share_buffer() || node.can_be_optimized() || node.is_output() || node.is_type<generic_layer>())
+            return false;
+        // in-place primitives use the buffer of their input
+        if (node.get_in_place_input() != nullptr)
+            return false;
+        if (node.get_output_layout().format.is_image())
+            return false;
+        // arenas are not cleared before every execution, so padding of a planned buffer would hold data of other
+        // primitives, while kernels reading padded inputs expect zeros there (padded pool keeps them cleared)
+        if (node.get_output_layout().data_padding)
+            return false;
+
+        // outputs fused with mutable_data or placed inside of optimized concatenation don't allocate memory
+        for (auto user : node.get_users())
+        {
+            if (user->is_type<mutable_data>())
+                return false;
+        }
+        if (node.get_users().size() == 1 &&
+            node.get_users().front()->is_type<concatenation>() &&
+            node.get_users().front()->can_be_optimized())
+            return false;
+        return true;
+    }
+
+    void memory_pool::plan_memory(const program_impl& program, uint32_t network_id)
+    {
+        _planned.clear();
+
+        std::vector<const program_node*> nodes(program.get_processing_order().begin(), program.get_processing_order().end());
+        std::map<const program_node*, int32_t> processing_num;
+        for (size_t i = 0; i < nodes.size(); ++i)
+            processing_num[nodes[i]] = static_cast<int32_t>(i);
+
+        // output of a node is alive until the last of its users is executed, optimized out and in-place users share the buffer
+        // so liveness is propagated through them (users are always after the node in processing order)
+        std::map<const program_node*, int32_t> last_use;
+        for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+        {
+            auto node = *it;
+            auto last = processing_num[node];
+            for (auto user : node->get_users())
+                last = std::max(last, user->can_be_optimized() || user->get_in_place_input() == node ? last_use[user] : processing_num[user]);
+            last_use[node] = last;
+        }
+
+        std::vector<const program_node*> planned_nodes;
+        std::vector<memory_plan_request> requests;
+        for (auto node : nodes)
+        {
+            if (!is_memory_planned(*node))
+                continue;
+            planned_nodes.push_back(node);
+            requests.emplace_back(node->id(), node->get_output_layout().bytes_count());
+        }
+
+        for (size_t i = 0; i < planned_nodes.size(); ++i)
+        {
+            const auto& restrictions = planned_nodes[i]->get_memory_restrictions();
+            for (size_t j = i + 1; j < planned_nodes.size(); ++j)
+            {
+                bool live_ranges_overlap = processing_num[planned_nodes[j]] <= last_use[planned_nodes[i]];
+                if (live_ranges_overlap ||
+                    restrictions.contains(planned_nodes[j]->get_memory_index()) ||
+                    planned_nodes[j]->get_memory_restrictions().contains(planned_nodes[i]->get_memory_index()))
+                {
+                    requests[i]._conflicts.push_back(j);
+                    requests[j]._conflicts.push_back(i);
+                }
+            }
+        }
+
+        auto context = _engine->get_context();
+        auto alignment = context->device().getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>() / 8;
+        // size of an arena is described by a single dimension of its layout
+        auto max_arena_size = std::min<uint64_t>(context->get_engine_info().max_alloc_mem_size, std::numeric_limits<tensor::value_type>::max());
+        auto plan = make_memory_plan(requests, alignment, max_arena_size);
+        _planned_memory_size = plan.get_planned_size();
+        _naive_memory_size = plan._naive_size;
+        if (_planned_memory_size == 0 || _planned_memory_size >= _naive_memory_size)
+            return; // nothing to gain, pools will handle the network
+
+        // arenas are shared between networks the same way as pooled buffers are, they only grow when needed
+        for (size_t arena = 0; arena < plan._arenas.size(); ++arena)
+        {
+            if (arena < _arenas.size() && _arenas[arena]->size() >= plan._arenas[arena])
+                continue;
+
+            layout arena_layout(data_types::i8, format::bfyx, { 1, 1, static_cast<tensor::value_type>(plan._arenas[arena]), 1 });
+            auto mem = alloc_memory(arena_layout, resource_flags::READ_WRITE, nullptr, false);
+            if (arena < _arenas.size())
+            {
+                // replaced arena releases its engine reference which was detached when it was stored
+                _engine->add_ref();
+                _arenas[arena] = mem;
+            }
+            else
+                _arenas.push_back(mem);
+            // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
+            _engine->release();
+        }
+
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            const auto& placement = plan._placements[i];
+            if (placement._arena == memory_plan::unplanned)
+                continue;
+            _planned.emplace(std::make_pair(network_id, planned_nodes[i]->get_memory_index()), std::make_pair(_arenas[placement._arena], placement));
+        }
+    }
+
+    memory_impl::ptr memory_pool::get_memory(const layout& layout, bool reset)
+    {
+        return alloc_memory(layout, resource_flags::NONE, nullptr, reset);
+    }
+
+    memory_impl::ptr memory_pool::get_host_memory(const layout& layout, void* host_ptr)
+    {
+        // memory provided by the user keeps its content
+        if (host_ptr)
+            return alloc_memory(layout, resource_flags::USE_HOST_PTR, nullptr, false, host_ptr);
+        return alloc_memory(layout, resource_flags::ALLOC_HOST_PTR);
     }
 
     memory_impl::ptr memory_pool::alloc_and_copy_memory(memory_impl::ptr src, resource_flags flags)
@@ -189,19 +505,30 @@ namespace cldnn
         return alloc_memory(src->get_layout(), flags, src);
     }
 
-    memory_impl::ptr memory_pool::get_memory(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, bool reusable_across_network)
+    memory_impl::ptr memory_pool::get_memory(const layout& layout, const primitive_id& id, uint32_t memory_index, uint32_t network_id, const memory_restrictions& restrictions, bool reusable_across_network)
     {
         if (reusable_across_network) //reusable within the same network
         {
+            if (!_planned.empty() && !layout.format.is_image())
+            {
+                auto mem = get_from_memory_plan(layout, memory_index, network_id);
+                if (mem)
+                    return mem;
+            }
+
             if (!layout.format.is_image() && layout.data_padding == padding{ { 0,0,0,0 }, 0 }) // non-padded buffers
             {
-                return get_from_non_padded_pool(layout, id, network_id, restrictions);
+                return get_from_non_padded_pool(layout, id, memory_index, network_id, restrictions);
             }
             else if (!layout.format.is_image()) // padded buffers
             {
-                return get_from_padded_pool(layout, id, network_id, restrictions);
+                return get_from_padded_pool(layout, id, memory_index, network_id, restrictions);
+            }
+            else if (layout.format.is_image_2d()) // images 2d
+            {
+                return get_from_image2d_pool(layout, id, memory_index, network_id, restrictions);
             }
-            else  // images
+            else  // images 2d arrays
             {
                 // not yet implemented
                 return alloc_memory(layout, resource_flags::NONE);
@@ -209,19 +536,38 @@ namespace cldnn
         }
         else
         {
-            return get_from_across_networks_pool(layout, id, network_id);
+            return get_from_across_networks_pool(layout, id, memory_index, network_id);
         }
     }
 
+    void memory_pool::release_records(size_t records_count)
+    {
+        // each stored record has detached its engine reference (see get_from_*_pool), restore them before records are destroyed
+        for (size_t i = 0; i < records_count; ++i)
+            _engine->add_ref();
+    }
+
     void memory_pool::clear_pool()
     {
+        size_t records_count = _non_padded_pool.size() + _no_reusable_pool.size() + _image2d_pool.size() + _arenas.size();
+        for (const auto& list : _padded_pool)
+            records_count += list.second.size();
+        release_records(records_count);
+
         _non_padded_pool.clear();
+        _padded_pool.clear();
+        _no_reusable_pool.clear();
+        _image2d_pool.clear();
+        _arenas.clear();
+        _planned.clear();
     }
 
     memory_pool::memory_pool(engine_impl& engine)
         : _engine(&engine)
         , _temp_memory_used(0)
         , _max_peak_memory_used(0)
+        , _planned_memory_size(0)
+        , _naive_memory_size(0)
     {
         _engine->release(); // since engine is refcount object and there is circular dependency until context will be moved to memory pool we need 
                             // to detach engine while destroying memory pool
@@ -232,16 +578,33 @@ namespace cldnn
         using namespace std;
         ofstream log(path);
 
-        log << "\nNon-padded pool:" <<endl;
-        log << "Size\tUsers:" << endl;
-        for (const auto& record : _non_padded_pool)
+        // records count, allocated bytes and users count of each pool
+        auto log_summary = [&log](const std::string& name, size_t records, uint64_t bytes, size_t users)
         {
-            log << record.first;
-            for (const auto& usr : record.second._users)
-                log << ", " << usr;
-            log << endl;
-        }
+            log << name << ": " << records << " records, " << bytes << " bytes, " << users << " users" << endl;
+        };
+        auto dump_pool = [&log, &log_summary](const std::string& name, const std::multimap<uint64_t, memory_record>& pool)
+        {
+            uint64_t bytes = 0;
+            size_t users = 0;
+            log << "\n--- " << name << ": ---" << endl;
+            log << "Size\tUsers:" << endl;
+            for (const auto& record : pool)
+            {
+                log << record.first;
+                for (const auto& usr : record.second._users)
+                    log << ", " << usr;
+                log << endl;
+                bytes += record.second._memory->size();
+                users += record.second._users.size();
+            }
+            log_summary(name, pool.size(), bytes, users);
+        };
 
+        dump_pool("Non-padded pool", _non_padded_pool);
+
+        uint64_t padded_bytes = 0;
+        size_t padded_records = 0, padded_users = 0;
         log << "\n--- Padded pool: ---" << endl;
         log << "Size\tUsers:" << endl;
         for (const auto& record : _padded_pool)
@@ -252,8 +615,23 @@ namespace cldnn
                 for (const auto& usr : mem._users)
                     log << ", " << usr;
                 log << endl;
+                padded_bytes += mem._memory->size();
+                padded_users += mem._users.size();
+                ++padded_records;
             }
         }
+        log_summary("Padded pool", padded_records, padded_bytes, padded_users);
+
+        dump_pool("Image 2d pool", _image2d_pool);
+        dump_pool("Across networks pool", _no_reusable_pool);
+
+        log << "\n--- Memory plan: ---" << endl;
+        log << "Arenas:";
+        for (const auto& arena : _arenas)
+            log << " " << arena->size();
+        log << endl;
+        log << "Planned peak: " << _planned_memory_size << ", naive peak: " << _naive_memory_size << endl;
+
         log << dep;
         log.close();
         color_graph(program);
@@ -272,6 +650,16 @@ namespace cldnn
             ++color;
         }
 
+        for (const auto& record : _image2d_pool)
+        {
+            for (const auto& usr : record.second._users)
+            {
+                if (program.has_node(usr._id))
+                    program.get_node(usr._id).set_reused_memory_color(color);
+            }
+            ++color;
+        }
+
         for (const auto& list : _padded_pool)
         {
             for (const auto& record : list.second)
@@ -38,8 +38,8 @@ namespace {
             return &mem;
 
         memory_impl::ptr result = engine.allocate_memory(mem.get_layout());
-        mem_lock<char> src(mem);
-        mem_lock<char> dst(result);
+        mem_lock<char> src(mem, lock_mode::read);
+        mem_lock<char> dst(result, lock_mode::write);
         std::copy(src.begin(), src.end(), dst.begin());
         return result;
     }
@@ -28,29 +28,52 @@
 #include "input_layout_inst.h"
 #include "condition_inst.h"
 #include "kernel_selector_helper.h"
+#include "queue_scheduler.h"
 #include <algorithm>
 
 #include "gpu/ocl_toolkit.h"
+#include "gpu/ocl_base_event.h"
+#include "gpu/ocl_user_event.h"
+#include "gpu/events_pool.h"
 
 namespace cldnn
 {
+namespace
+{
+    // waiting for an event of other queue costs roughly as much as moving 1MB of data
+    const uint64_t cross_queue_wait_cost = 1 << 20;
+
+    // kernels are mostly bound by memory traffic, so the bytes a step reads and writes estimate its execution time for the queue scheduler
+    uint64_t estimate_cost(const primitive_inst& inst)
+    {
+        uint64_t cost = inst.output_memory().get_layout().bytes_count();
+        for (auto& dep : inst.dependencies())
+            cost += dep->output_memory().get_layout().bytes_count();
+        return cost;
+    }
+}
+
 /*
 Network_impl will always have net_id = 0 when it will be cldnn internal micronetwork (created i.e by propagate_constants opt pass).
 */
-network_impl::network_impl(const program_impl& program, bool is_internal)
+network_impl::network_impl(const program_impl& program, bool is_internal, bool is_concurrent)
     : _program(&program)
     , _internal(is_internal)
+    , _events_owner(new gpu::events_owner())
 {
     static std::atomic<uint32_t> id_gen{ 0 };
     if (!_internal)
     {
         net_id = ++id_gen;
+        if (is_concurrent)
+            get_engine().get_memory_pool().add_concurrent_network(net_id);
     }
 
     allocate_primitives();
     check_names();
     build_insts_deps();
     build_exec_order();
+    build_exec_plan();
     validate_primitives();
     _program->dump_memory_pool();
 }
@@ -65,6 +88,8 @@ network_impl::network_impl(engine_impl& engine, const std::set<std::shared_ptr<p
 {
 }
 
+network_impl::~network_impl() = default;
+
 void network_impl::validate_primitives()
 {
     for (auto const& prim : _exec_order)
@@ -76,13 +101,12 @@ void network_impl::validate_primitives()
 
 void network_impl::reset_execution(bool wait)
 {
-    if (wait && _events.size() > 0)
+    if (wait)
     {
         std::vector<event_impl::ptr> events;
-        for (auto& pair : _events)
+        for (auto& ev : _events)
         {
-            auto& ev = pair.second;
-            if (ev->is_set())
+            if (!ev || ev->is_set())
                 continue;
 
             events.push_back(ev);
@@ -90,7 +114,9 @@ void network_impl::reset_execution(bool wait)
 
         get_engine().wait_for_events(events);
     }
-    _events.clear();
+    for (auto& ev : _events)
+        ev = nullptr;
+    _deps_events.clear();
 }
 
 void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
@@ -114,6 +140,27 @@ void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
     input->set_data(data);
 }
 
+void network_impl::set_output_memory(const primitive_id& id, memory_impl& mem)
+{
+    auto primitive_inst = find_primitive(id);
+
+    if (primitive_inst == nullptr)
+        throw std::runtime_error("topology doesn't contain prmitive:" + id);
+
+    if (std::find(_outputs.begin(), _outputs.end(), primitive_inst) == _outputs.end())
+    {
+        CLDNN_ERROR_MESSAGE(id, "primitive " + id + " is not an output");
+    }
+
+    //Wait for previous execution completion
+    reset_execution(true);
+    if (!primitive_inst->set_output_memory(mem))
+    {
+        CLDNN_ERROR_MESSAGE(id, "memory can't be the output of primitive " + id +
+            " - it has to be allocated by the network engine with the output layout, and the primitive has to write its own buffer");
+    }
+}
+
 void cldnn::network_impl::check_names()
 {
     for (auto const& prim : _primitives)
@@ -183,6 +230,9 @@ void network_impl::allocate_primitives()
         return (lhs->get_output_layout().bytes_count() > rhs->get_output_layout().bytes_count());
     });
 
+    if (!_internal && get_engine().use_memory_planner() && !get_engine().get_memory_pool().is_concurrent_network(net_id))
+        get_engine().get_memory_pool().plan_memory(*_program, net_id);
+
     for (auto const& node : nodes_to_allocate)
     {
         allocate_primitive_instance(*node);
@@ -214,51 +264,130 @@ void network_impl::add_to_exec_order(const primitive_id& id)
     _exec_order.push_back(inst);
 }
 
-void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& events)
+void network_impl::build_exec_plan()
 {
-    //Wait for previous execution completion
-    reset_execution(false);
+    _exec_plan.clear();
+    _events_aliases.clear();
+    _data_outputs_slots.clear();
+    _events_slots.clear();
 
+    // step i of the plan writes its event to slot i, other primitives which can be asked for event get slots after them
     for (auto& inst : _exec_order)
+        _events_slots.emplace(inst->id(), _events_slots.size());
+    auto get_slot = [this](const primitive_id& id)
     {
-        execute_primitive(inst, events);
+        return _events_slots.emplace(id, _events_slots.size()).first->second;
+    };
+
+    auto single_kernel = get_engine().get_context()->enabled_single_kernel();
+    for (auto& inst : _exec_order)
+    {
+        exec_step step{ inst, {}, single_kernel && get_engine().get_context()->single_kernel_name() != inst->id(), 0 };
+        step.deps.reserve(inst->exec_dependencies().size());
+        for (auto& dep : inst->exec_dependencies())
+            step.deps.push_back(get_slot(dep->id()));
+        _exec_plan.push_back(std::move(step));
     }
 
-    for (auto& inst : _program->get_processing_order())
+    // internal networks run on the queue of the primitive which executes them
+    auto queues_count = get_engine().get_context()->get_queues_count();
+    _multi_queue = !_internal && queues_count > 1 && !single_kernel;
+    if (_multi_queue)
     {
-        //Special handling for mutable data. The event should be the same as the user or dependency with highest processing_num as
-        //the mutable_data can be updated when is both user or dependency.
-        if (inst->is_type<mutable_data>())
+        std::vector<queue_schedule_request> requests;
+        requests.reserve(_exec_plan.size());
+        for (auto& step : _exec_plan)
         {
-            decltype(_program->get_processing_order().get_processing_number(inst)) proc_num = 0;
-            for (auto& user : inst->get_users())
+            requests.emplace_back(estimate_cost(*step.inst));
+            // slots of not executed primitives are after the steps
+            for (auto slot : step.deps)
             {
-                auto user_proc_num = _program->get_processing_order().get_processing_number(user);
-                if (user_proc_num > proc_num)
-                {
-                    _events[inst->id()] = _events[user->id()];
-                    proc_num = user_proc_num;
-                }
+                if (slot < requests.size() - 1)
+                    requests.back()._deps.push_back(slot);
             }
+        }
+
+        auto schedule = make_queue_schedule(requests, queues_count, cross_queue_wait_cost);
+        for (size_t i = 0; i < _exec_plan.size(); ++i)
+            _exec_plan[i].queue = schedule._queues[i];
+    }
 
-            if (!inst->get_dependencies().empty())
+    //Special handling for mutable data. The event should be the same as the user or dependency with highest processing_num as
+    //the mutable_data can be updated when is both user or dependency.
+    std::unordered_map<const program_node*, int32_t> processing_num;
+    for (auto& node : _program->get_processing_order())
+        processing_num.emplace(node, static_cast<int32_t>(processing_num.size()) + 1);
+
+    for (auto& inst : _program->get_processing_order())
+    {
+        if (!inst->is_type<mutable_data>())
+            continue;
+
+        const program_node* source = nullptr;
+        int32_t proc_num = 0;
+        for (auto& user : inst->get_users())
+        {
+            if (processing_num.at(user) > proc_num)
+            {
+                source = user;
+                proc_num = processing_num.at(user);
+            }
+        }
+        for (auto& dep : inst->get_dependencies())
+        {
+            if (processing_num.at(dep) > proc_num)
             {
-                for (auto& dep : inst->get_dependencies())
-                {
-                    auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
-                    if (dep_proc_num > proc_num)
-                    {
-                        _events[inst->id()] = _events[dep->id()];
-                        proc_num = dep_proc_num;
-                    }
-                }
+                source = dep;
+                proc_num = processing_num.at(dep);
             }
         }
+        if (source != nullptr)
+            _events_aliases.emplace_back(get_slot(inst->id()), get_slot(source->id()));
     }
 
-    for (auto& dout : _data_outputs) //data primitives are not executed so if they are marked as output we need to add them valid events manually
+    for (auto& dout : _data_outputs)
+        _data_outputs_slots.push_back(get_slot(dout->id()));
+
+    _events.assign(_events_slots.size(), nullptr);
+    size_t max_deps = 0;
+    for (auto& step : _exec_plan)
+        max_deps = std::max(max_deps, step.deps.size());
+    _deps_events.reserve(max_deps);
+}
+
+void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& events)
+{
+    //Wait for previous execution completion
+    reset_execution(false);
+
+    // memory is written and read by the host through the main queue, so other queues wait for it and it waits for them at the end
+    auto context = get_engine().get_context();
+    // network executed by a primitive of another one (e.g. condition branch) returns events to its caller, so they
+    // belong to the outer execution and are reset with its events
+    auto outer_events = context->get_events_owner();
+    gpu::gpu_toolkit::execution_scope scope(*context, outer_events ? *outer_events : *_events_owner);
+    if (_multi_queue)
+        context->synchronize_queues();
+
+    for (size_t i = 0; i < _exec_plan.size(); ++i)
+    {
+        if (_multi_queue)
+            scope.set_queue(_exec_plan[i].queue);
+        _events[i] = execute_step(_exec_plan[i], events);
+    }
+
+    if (_multi_queue)
     {
-        _events[dout->id()] = get_engine().create_user_event(true);
+        scope.set_queue(0);
+        context->synchronize_queues();
+    }
+
+    for (auto& alias : _events_aliases)
+        _events[alias.first] = _events[alias.second];
+
+    for (auto slot : _data_outputs_slots) //data primitives are not executed so if they are marked as output we need to add them valid events manually
+    {
+        _events[slot] = get_engine().create_user_event(true);
     }
 
     for (auto& prim : _primitives)
@@ -266,7 +395,8 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
         prim.second->reset_output_change();
     }
 
-    get_engine().get_context()->reset_events();
+    if (!outer_events)
+        context->reset_events(*_events_owner);
 
     // Using output of previouse network as input to another one may cause hazard (in OOOQ mode) if user would not 
     // provide proper event to execution. Flushing pipeline should prevent this kind of issues. 
@@ -337,19 +467,30 @@ std::vector<std::shared_ptr<primitive_inst>> network_impl::get_primitives(const
     return result;
 }
 
-void network_impl::execute_primitive(const std::shared_ptr<primitive_inst>& primitive, const std::vector<refcounted_obj_ptr<event_impl>>& events)
+event_impl::ptr network_impl::execute_step(const exec_step& step, const std::vector<refcounted_obj_ptr<event_impl>>& events)
+{
+    if (step.skipped)
+        return get_engine().create_user_event(true);
+    if (step.deps.empty())
+        return step.inst->execute(events);
+
+    _deps_events.clear();
+    for (auto slot : step.deps)
+    {
+        // if the requested event does not exist it means that it has not been executed, so the processing_order is wrong or synchronization failed.
+        if (!_events[slot])
+            CLDNN_ERROR_MESSAGE(step.inst->id(), "internal CLDNN error: execution order corrupted.");
+        _deps_events.push_back(_events[slot]);
+    }
+    return step.inst->execute(_deps_events);
+}
+
+const event_impl::ptr& network_impl::get_primitive_event(const primitive_id& id) const
 {
-    auto id = primitive->id();
-    auto it = _events.find(id);
-    bool found = (it != _events.end());
-    CLDNN_ERROR_BOOL(id, "Invalid primitive call ", found, "Primitive " + id + " is tried to be executed for the second time");
-
-    event_impl::ptr ev;
-    if (!get_engine().get_context()->enabled_single_kernel() || get_engine().get_context()->single_kernel_name() == id)
-        ev = primitive->execute(events);
-    else
-        ev = get_engine().create_user_event(true);
-    _events.insert({ id, ev });
+    const auto& ev = _events.at(_events_slots.at(id));
+    if (!ev)
+        throw std::out_of_range("primitive " + id + " has not been executed");
+    return ev;
 }
 
 void network_impl::allocate_primitive_instance(program_node const& node)
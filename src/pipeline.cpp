@@ -0,0 +1,210 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "pipeline_impl.h"
+#include "engine_impl.h"
+#include "error_handler.h"
+#include "primitive_inst.h"
+#include "input_layout_inst.h"
+
+#include "gpu/memory_gpu.h"
+#include "gpu/ocl_toolkit.h"
+
+#include <algorithm>
+
+namespace cldnn
+{
+namespace
+{
+    gpu::gpu_buffer& get_buffer(const primitive_id& id, memory_impl& mem)
+    {
+        auto buffer = dynamic_cast<gpu::gpu_buffer*>(&mem);
+        if (buffer == nullptr)
+            CLDNN_ERROR_MESSAGE(id, "pipelined requests support only buffers as inputs and outputs");
+        return *buffer;
+    }
+}
+
+pipeline_impl::pipeline_impl(const program_impl& program, uint32_t requests_count)
+    : _program(&program)
+{
+    if (requests_count == 0)
+        CLDNN_ERROR_MESSAGE("pipeline", "number of requests has to be positive");
+
+    for (uint32_t i = 0; i < requests_count; ++i)
+    {
+        std::unique_ptr<request> req(new request());
+        req->network = get_engine().allocate_network(program, false, true);
+        for (auto node : program.get_processing_order())
+        {
+            if (!node->is_type<input_layout>())
+                continue;
+
+            auto input_layout = node->get_output_layout();
+            if (input_layout.format.is_image())
+                CLDNN_ERROR_MESSAGE(node->id(), "pipelined requests support only buffers as inputs and outputs");
+            auto mem = get_engine().allocate_memory(input_layout);
+            req->network->set_input_data(node->id(), *mem);
+            req->inputs.emplace_back(node->id(), mem);
+        }
+        _requests.push_back(std::move(req));
+    }
+}
+
+pipeline_impl::~pipeline_impl()
+{
+    wait();
+}
+
+layout pipeline_impl::get_layout(const primitive_id& id) const
+{
+    return _requests.front()->network->get_primitive(id)->output_memory().get_layout();
+}
+
+void pipeline_impl::submit(const std::vector<std::pair<primitive_id, const void*>>& inputs,
+                           const std::vector<std::pair<primitive_id, void*>>& outputs,
+                           completion_handler handler)
+{
+    std::lock_guard<std::mutex> submit_lock(_submit_mutex);
+    auto& req = *_requests[_next_request];
+    {
+        std::unique_lock<std::mutex> lock(_state_mutex);
+        _request_finished.wait(lock, [&req] { return !req.busy; });
+        req.busy = true;
+        _pending++;
+    }
+    _next_request = (_next_request + 1) % _requests.size();
+
+    auto context = get_engine().get_context();
+    try
+    {
+        const auto& transfer_queue = context->transfer_queue();
+        std::vector<cl::Event> writes;
+        for (const auto& input : inputs)
+        {
+            auto it = std::find_if(req.inputs.begin(), req.inputs.end(),
+                [&input](const std::pair<primitive_id, memory_impl::ptr>& in) { return in.first == input.first; });
+            if (it == req.inputs.end())
+                CLDNN_ERROR_MESSAGE(input.first, "input of pipelined request is not an input_layout of the network");
+            writes.emplace_back();
+            get_buffer(input.first, *it->second).write_async(input.second, {}, writes.back());
+        }
+        if (!writes.empty())
+            cl::WaitForEvents(writes);
+
+        req.network->execute({});
+
+        // at the end of the execution every queue is synchronized with the main one,
+        // so the marker is reached when everything enqueued for this request is finished
+        std::vector<cl::Event> executed(1);
+        context->queue().enqueueMarkerWithWaitList(nullptr, &executed[0]);
+        context->flush();
+
+        auto output_ids = req.network->get_output_ids();
+        for (const auto& output : outputs)
+        {
+            if (std::find(output_ids.begin(), output_ids.end(), output.first) == output_ids.end())
+                CLDNN_ERROR_MESSAGE(output.first, "output of pipelined request is not an output of the network");
+            cl::Event read_event;
+            get_buffer(output.first, req.network->get_primitive(output.first)->output_memory()).read_async(output.second, executed, read_event);
+        }
+
+        // transfer queue is in-order, so the marker is reached after the reads
+        cl::Event done;
+        transfer_queue.enqueueMarkerWithWaitList(&executed, &done);
+        transfer_queue.flush();
+        req.handler = std::move(handler);
+
+        // the completion callback must not block, so it only queues the handler for a worker,
+        // it is registered last - once it is armed, the request is finished by it and must not be cancelled
+        auto& host_tasks = context->get_host_tasks();
+        std::unique_ptr<std::function<void(cl_int)>> job(new std::function<void(cl_int)>([this, &req, &host_tasks](cl_int status)
+        {
+            host_tasks.submit([this, &req, status]() { finish(req, status == CL_COMPLETE ? CLDNN_SUCCESS : CLDNN_ERROR); });
+        }));
+        done.setCallback(CL_COMPLETE, [](cl_event, cl_int status, void* data)
+        {
+            std::unique_ptr<std::function<void(cl_int)>> job(static_cast<std::function<void(cl_int)>*>(data));
+            (*job)(status);
+        }, job.get());
+        job.release();
+    }
+    catch (cl::Error const& err)
+    {
+        cancel(req);
+        throw gpu::ocl_error(err);
+    }
+    catch (...)
+    {
+        cancel(req);
+        throw;
+    }
+}
+
+void pipeline_impl::wait()
+{
+    std::unique_lock<std::mutex> lock(_state_mutex);
+    _request_finished.wait(lock, [this] { return _pending == 0; });
+}
+
+void pipeline_impl::finish(request& req, cldnn_status status)
+{
+    // the slot is free before the handler is called, so the handler can submit next request
+    auto handler = std::move(req.handler);
+    {
+        std::lock_guard<std::mutex> lock(_state_mutex);
+        req.busy = false;
+        _request_finished.notify_all();
+    }
+
+    if (handler)
+    {
+        try
+        {
+            handler(status);
+        }
+        catch (...)
+        {
+            // exceptions can't be passed to the user from a worker thread
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_state_mutex);
+    _pending--;
+    _request_finished.notify_all();
+}
+
+void pipeline_impl::cancel(request& req)
+{
+    // kernels and copies which were already enqueued still use the slot
+    try
+    {
+        auto context = get_engine().get_context();
+        context->queue().finish();
+        context->transfer_queue().finish();
+    }
+    catch (...)
+    {
+    }
+
+    std::lock_guard<std::mutex> lock(_state_mutex);
+    req.busy = false;
+    req.handler = nullptr;
+    _pending--;
+    _request_finished.notify_all();
+}
+}
@@ -45,25 +45,7 @@ event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& even
     CLDNN_ERROR_BOOL(primitive_id, "Invalid/unset input", !_has_valid_input, "Cannot execute primitive " + primitive_id + " with invalid/unset input");
     on_execute();
 
-    if (_exec_deps.size() == 0)
-        return _impl->execute(events, *this);
-
-    std::vector<event_impl::ptr> dependencies;
-    dependencies.reserve(_exec_deps.size());
-    for (auto& input : _exec_deps)
-    {
-        auto id = input->id();
-        try {
-            // if the requested event deos not exits it means that it has not been executed, so the processing_order is wrong or synchronization failed.
-            auto ev = get_network().get_primitive_event(id);
-            dependencies.emplace_back(ev);
-            }
-        catch (const std::out_of_range& oor) {
-            std::string temp = std::string("internal CLDNN error: execution order corrupted.") + std::string("\n") + std::string(oor.what() + std::string("\n"));
-            CLDNN_ERROR_MESSAGE(id, temp);
-        }
-    }
-    return _impl->execute(dependencies, *this);
+    return _impl->execute(events, *this);
 }
 
 void primitive_inst::build_deps()
@@ -80,9 +62,14 @@ primitive_inst::primitive_inst(network_impl& network, program_node const& node,
     , _node(node)
     , _impl(node.get_selected_impl())
     , _output()
-    , _output_changed(false)
+    , _output_changed(true) // output of a new instance is not bound to any kernel yet
 {
-    if (allocate_memory)
+    if (allocate_memory && node.get_in_place_input() != nullptr)
+    {
+        // layouts are the same, so the memory object of the input is used as is
+        _output = &_network.get_primitive(node.get_in_place_input()->id())->output_memory();
+    }
+    else if (allocate_memory)
     {
         //In case when output is mutable_data primitive, and other users dependencies are only used for suychronization,
         //The output memory of such primitive will be fused with mutable_data
@@ -122,6 +109,29 @@ primitive_inst::primitive_inst(network_impl& network, program_node const& node,
     }
 }
 
+bool primitive_inst::set_output_memory(memory_impl& mem)
+{
+    if (_node.is_type<input_layout>() || _node.is_type<data>() || _node.is_type<mutable_data>() || _node.can_be_optimized() ||
+        _node.get_in_place_input() != nullptr)
+        return false;
+
+    for (auto& user : _node.get_users())
+    {
+        if (user->can_be_optimized() || user->is_type<mutable_data>() || user->get_in_place_input() == &_node)
+            return false;
+    }
+
+    if (mem.get_layout() != _node.get_output_layout() || !mem.is_allocated_by(get_network().get_engine()))
+        return false;
+
+    if (_output.get() != &mem)
+    {
+        _output = &mem;
+        _output_changed = true;
+    }
+    return true;
+}
+
 memory_impl::ptr primitive_inst::allocate_output()
 {
     auto layout = _node.get_output_layout();
@@ -130,7 +140,7 @@ memory_impl::ptr primitive_inst::allocate_output()
         (_node.can_be_optimized() ||
         _node.is_type<generic_layer>()))
     {
-        return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), false);
+        return get_network().get_engine().allocate_memory(layout, _node.id(), _node.get_memory_index(), get_network_id(), _node.get_memory_restrictions(), false);
     }
     else if (_network.is_internal() ||
              (!_node.can_share_buffer()) ||
@@ -139,7 +149,7 @@ memory_impl::ptr primitive_inst::allocate_output()
     {
         return get_network().get_engine().allocate_memory(layout);
     }
-    return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), true);
+    return get_network().get_engine().allocate_memory(layout, _node.id(), _node.get_memory_index(), get_network_id(), _node.get_memory_restrictions(), true);
 }
 
 std::vector<std::shared_ptr<primitive_inst>> primitive_inst::build_exec_deps(std::vector<std::shared_ptr<primitive_inst>> const& deps)
@@ -18,6 +18,7 @@
 
 #include "error_handler.h"
 #include "kernel_selector_helper.h"
+#include "kernel_selector.h"
 #include "internal_primitive.h"
 #include "internal_primitive_type_base.h"
 #include "layout_optimizer.h"
@@ -307,6 +308,16 @@ void program_impl::set_options()
     {
         throw std::invalid_argument("Engine must be created with profiling enabled in tune_and_cache mode!");
     }
+
+    const auto& selection_cache_path = options.get<build_option_type::kernel_selection_cache>()->file_path;
+    if (!selection_cache_path.empty())
+    {
+        // selections are valid only for the same device, driver and kernels
+        const auto& engine_info = engine->get_context()->get_engine_info();
+        kernel_selection_cache = std::make_shared<kernel_selector::KernelSelectionCache>(
+            engine_info.dev_id + "_" + engine_info.driver_version + "_" + to_host_version(cldnn::get_version()));
+        kernel_selection_cache->Import(selection_cache_path);
+    }
 }
 
 void program_impl::build_program(bool is_internal)
@@ -321,6 +332,15 @@ void program_impl::build_program(bool is_internal)
     }
     prepare_memory_dependencies();
     engine->compile_program(*this);
+    if (options.get<build_option_type::tuning_config>()->config.mode == tuning_mode::tuning_tune_and_cache)
+    {
+        // on-line tuning results are batched in memory during the build - write them once
+        kernel_selector::kernel_selector_base::FlushTuningCache();
+    }
+    if (kernel_selection_cache && kernel_selection_cache->IsModified())
+    {
+        kernel_selection_cache->Export(options.get<build_option_type::kernel_selection_cache>()->file_path);
+    }
     cleanup();
 }
 
@@ -446,6 +466,13 @@ void program_impl::post_optimize_graph(bool is_internal)
 
     prep_opt_depthwise_sep_post prep_opt_depthwise_sep_post_pass;
     apply_opt_pass(prep_opt_depthwise_sep_post_pass);
+
+    // after the last change of the graph, in debug builds all outputs have to be preserved for the user
+    if (options.get<build_option_type::optimize_data>()->enabled() && !is_debug_build())
+    {
+        prepare_in_place_execution prepare_in_place_execution_pass;
+        apply_opt_pass(prepare_in_place_execution_pass);
+    }
 }
 
 // mark if the node is constant assuming that all dependencies are marked properly
@@ -546,12 +573,30 @@ const program_impl::nodes_ordering& program_impl::get_processing_order() const
     return processing_order;
 }
 
+// in-place primitive writes into the buffer of its input, which can be in-place as well
+static program_node* get_buffer_owner(program_node* node)
+{
+    while (node->get_in_place_input() != nullptr)
+        node = node->get_in_place_input();
+    return node;
+}
+
 void add_memory_dependency(program_node* node, program_node* dep)
 {
     if (node->can_be_optimized() ||
         !dep->can_be_optimized())
     {
-        node->add_memory_dependency(dep->id());
+        node->add_memory_dependency(dep->get_memory_index());
+
+        // only the owner of a buffer shared by in-place primitives gets it from the memory pool,
+        // so restrictions of any of the primitives apply to the owners
+        auto node_owner = get_buffer_owner(node);
+        auto dep_owner = get_buffer_owner(dep);
+        if (node_owner == dep_owner)
+            return;
+        node->add_memory_dependency(dep_owner->get_memory_index());
+        node_owner->add_memory_dependency(dep->get_memory_index());
+        node_owner->add_memory_dependency(dep_owner->get_memory_index());
     }
     else
     {
@@ -570,7 +615,7 @@ void add_memory_dependency(program_node* node, program_node* dep)
 void program_impl::basic_memory_dependencies()
 {
     auto itr = processing_order.begin();
-    std::vector<primitive_id> past_outputs;
+    memory_restrictions past_outputs;
     while (itr != processing_order.end())
     {
         auto& node = *itr;
@@ -590,9 +635,10 @@ void program_impl::basic_memory_dependencies()
         // Note we iterate over processing order, it means if primitve has processing num greater than any of outputs, this output
         // has to land on the primitve restriction list. Otherwise memory reuse can corrupt final results.
         node->add_memory_dependency(past_outputs);
+        get_buffer_owner(node)->add_memory_dependency(past_outputs);
         // if current node is an output add it to the outputs list after restriction.
         if (node->is_output())
-            past_outputs.push_back(node->id());
+            past_outputs.insert(node->get_memory_index());
     }
 }
 
@@ -688,14 +734,67 @@ void program_impl::oooq_memory_dependencies()
     }
 }
 
+void program_impl::multi_queue_memory_dependencies()
+{
+    // With several command queues independent branches run concurrently, so buffer of node A can be taken by node B
+    // only if A and everybody reading A buffer are finished before B through data dependencies.
+    // Nodes are indexed by memory index in processing order, so dependencies always have lower indices.
+    auto nodes_count = memory_indexed_nodes.size();
+    std::vector<memory_restrictions> predecessors(nodes_count);
+    for (size_t i = 0; i < nodes_count; ++i)
+    {
+        for (auto dep : memory_indexed_nodes[i]->get_dependencies())
+        {
+            predecessors[i].insert(dep->get_memory_index());
+            predecessors[i].insert(predecessors[dep->get_memory_index()]);
+        }
+    }
+
+    // optimized out and in-place users pass the buffer to their own users
+    std::vector<memory_restrictions> readers(nodes_count);
+    for (size_t i = nodes_count; i-- > 0;)
+    {
+        auto node = memory_indexed_nodes[i];
+        readers[i].insert(static_cast<uint32_t>(i));
+        for (auto user : node->get_users())
+        {
+            readers[i].insert(user->get_memory_index());
+            if (user->can_be_optimized() || user->get_in_place_input() == node)
+                readers[i].insert(readers[user->get_memory_index()]);
+        }
+    }
+
+    for (size_t a = 0; a < nodes_count; ++a)
+    {
+        if (memory_indexed_nodes[a]->is_type<data>())
+            continue;
+
+        for (size_t b = a + 1; b < nodes_count; ++b)
+        {
+            if (memory_indexed_nodes[b]->is_type<data>() || predecessors[b].includes(readers[a]))
+                continue;
+
+            add_memory_dependency(memory_indexed_nodes[a], memory_indexed_nodes[b]);
+            add_memory_dependency(memory_indexed_nodes[b], memory_indexed_nodes[a]);
+        }
+    }
+}
+
 void program_impl::prepare_memory_dependencies()
 {
+    // dense indices let memory restrictions be stored as bitsets
+    memory_indexed_nodes.assign(processing_order.begin(), processing_order.end());
+    for (size_t i = 0; i < memory_indexed_nodes.size(); ++i)
+        memory_indexed_nodes[i]->set_memory_index(static_cast<uint32_t>(i));
+
     if (!get_engine().configuration().enable_memory_pool)
         return;
 
     basic_memory_dependencies();
     skipped_branch_memory_dependencies();
     oooq_memory_dependencies();
+    if (get_engine().configuration().n_queues > 1)
+        multi_queue_memory_dependencies();
 }
 
 std::string program_impl::get_memory_dependencies_string() const
@@ -76,17 +76,19 @@ void program_node::remove_dependency(size_t idx)
 
 std::set<primitive_id> program_node::get_memory_dependencies() const
 {
-    return memory_dependencies;
+    std::set<primitive_id> ids;
+    memory_dependencies.for_each([&](uint32_t idx) { ids.insert(myprog.get_node_by_memory_index(idx).id()); });
+    return ids;
 }
 
-void program_node::add_memory_dependency(primitive_id prim)
+void program_node::add_memory_dependency(uint32_t memory_index)
 {
-    memory_dependencies.insert(prim);
+    memory_dependencies.insert(memory_index);
 }
 
-void program_node::add_memory_dependency(std::vector<primitive_id> prim_list)
+void program_node::add_memory_dependency(const memory_restrictions& restrictions)
 {
-    memory_dependencies.insert(prim_list.begin(),prim_list.end());
+    memory_dependencies.insert(restrictions);
 }
 
 std::unique_ptr<json_composite> program_node::desc_to_json() const
@@ -0,0 +1,147 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "queue_scheduler.h"
+
+namespace cldnn
+{
+
+namespace
+{
+    const size_t no_request = std::numeric_limits<size_t>::max();
+
+    void check_requests(const std::vector<queue_schedule_request>& requests)
+    {
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            for (auto dep : requests[i]._deps)
+            {
+                if (dep >= i)
+                    throw std::invalid_argument("queue schedule request " + std::to_string(i) + " depends on a later request " + std::to_string(dep));
+            }
+        }
+    }
+
+    // time when request can start on given queue if its dependencies finished at given times
+    uint64_t ready_time(const queue_schedule_request& request, uint16_t queue, const std::vector<uint16_t>& queues,
+                        const std::vector<uint64_t>& finish, uint64_t sync_cost)
+    {
+        uint64_t ready = 0;
+        for (auto dep : request._deps)
+            ready = std::max(ready, finish[dep] + (queues[dep] != queue ? sync_cost : 0));
+        return ready;
+    }
+}
+
+queue_schedule make_queue_schedule(const std::vector<queue_schedule_request>& requests, uint16_t queues_count, uint64_t sync_cost)
+{
+    check_requests(requests);
+    if (queues_count <= 1)
+        return simulate_queue_schedule(requests, std::vector<uint16_t>(requests.size(), 0), sync_cost);
+
+    // bottom levels and critical users, users are always after their dependencies
+    std::vector<uint64_t> bottom_level(requests.size(), 0);
+    std::vector<size_t> critical_user(requests.size(), no_request);
+    for (size_t i = requests.size(); i-- > 0;)
+    {
+        bottom_level[i] += requests[i]._cost;
+        for (auto dep : requests[i]._deps)
+        {
+            // ties go to the earlier user
+            if (bottom_level[i] >= bottom_level[dep])
+            {
+                critical_user[dep] = i;
+                bottom_level[dep] = bottom_level[i];
+            }
+        }
+    }
+
+    std::vector<uint16_t> queues(requests.size(), 0);
+    std::vector<uint64_t> finish(requests.size(), 0);
+    std::vector<uint64_t> queue_free(queues_count, 0);
+    std::vector<size_t> reserved_for(queues_count, no_request);
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        // (start time, 0 if reserved for this request, 1 if free, 2 if reserved for other one, queue index)
+        auto best = std::make_tuple(std::numeric_limits<uint64_t>::max(), 0, uint16_t(0));
+        for (uint16_t q = 0; q < queues_count; ++q)
+        {
+            auto start = std::max(queue_free[q], ready_time(requests[i], q, queues, finish, sync_cost));
+            int reservation = reserved_for[q] == i ? 0 : reserved_for[q] == no_request ? 1 : 2;
+            if (reservation == 2)
+                start += requests[i]._cost;
+            auto candidate = std::make_tuple(start, reservation, q);
+            if (candidate < best)
+                best = candidate;
+        }
+
+        auto queue = std::get<2>(best);
+        queues[i] = queue;
+        finish[i] = std::max(queue_free[queue], ready_time(requests[i], queue, queues, finish, sync_cost)) + requests[i]._cost;
+        queue_free[queue] = finish[i];
+
+        // reservation of other queue for this request is not needed anymore
+        for (auto& reservation : reserved_for)
+        {
+            if (reservation == i)
+                reservation = no_request;
+        }
+        reserved_for[queue] = critical_user[i];
+    }
+
+    return simulate_queue_schedule(requests, std::move(queues), sync_cost);
+}
+
+queue_schedule simulate_queue_schedule(const std::vector<queue_schedule_request>& requests, std::vector<uint16_t> queues, uint64_t sync_cost)
+{
+    check_requests(requests);
+    if (queues.size() != requests.size())
+        throw std::invalid_argument("queue schedule has different number of queues and requests");
+
+    queue_schedule schedule;
+    std::vector<uint64_t> finish(requests.size(), 0);
+    std::vector<uint64_t> queue_free;
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        auto queue = queues[i];
+        if (queue >= queue_free.size())
+            queue_free.resize(queue + 1, 0);
+
+        for (auto dep : requests[i]._deps)
+        {
+            if (queues[dep] != queue)
+                schedule._cross_queue_waits++;
+        }
+
+        finish[i] = std::max(queue_free[queue], ready_time(requests[i], queue, queues, finish, sync_cost)) + requests[i]._cost;
+        queue_free[queue] = finish[i];
+        schedule._makespan = std::max(schedule._makespan, finish[i]);
+        schedule._serial_time += requests[i]._cost;
+    }
+
+    schedule._queues = std::move(queues);
+    return schedule;
+}
+
+}
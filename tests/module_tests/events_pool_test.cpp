@@ -62,4 +62,40 @@ TEST(events_pool, DISABLED_basic_test)
         EXPECT_EQ(eng.get_max_used_device_memory_size(), (uint64_t)80);
         eng.~engine();
     }
-}
\ No newline at end of file
+}
+TEST(events_pool, events_reused_between_executions)
+{
+    /*
+    Events are returned to the pool after every execution, outputs of consecutive executions have to stay correct.
+    */
+    const auto& engine = get_test_engine();
+
+    topology topology;
+    topology.add(input_layout("input", { data_types::f32, format::bfyx, { 1, 4, 1, 1 } }));
+    primitive_id prev = "input";
+    for (int i = 0; i < 32; i++)
+    {
+        auto id = "relu" + std::to_string(i);
+        topology.add(activation(id, prev, activation_relu));
+        prev = id;
+    }
+
+    network network1(engine, topology);
+    network network2(engine, topology);
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 4, 1, 1 } });
+    set_values(input, { -1.f, 2.f, -3.f, 4.f });
+    network1.set_input_data("input", input);
+    network2.set_input_data("input", input);
+
+    std::vector<float> expected = { 0.f, 2.f, 0.f, 4.f };
+    for (int i = 0; i < 50; i++)
+    {
+        for (auto net : { &network1, &network2 })
+        {
+            auto outputs = net->execute();
+            auto output_ptr = outputs.at(prev).get_memory().pointer<float>();
+            for (size_t j = 0; j < expected.size(); j++)
+                EXPECT_FLOAT_EQ(output_ptr[j], expected[j]);
+        }
+    }
+}
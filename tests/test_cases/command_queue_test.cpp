@@ -21,6 +21,8 @@
 #include <api/CPP/input_layout.hpp>
 #include "test_utils/test_utils.h"
 #include "api/CPP/arg_max_min.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/eltwise.hpp"
 
 using namespace cldnn;
 using namespace tests;
@@ -162,4 +164,56 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
             throttle_mode_types::low);
     cldnn::engine engine(configuration);
     exexute_network(engine);
-}
\ No newline at end of file
+}
+
+TEST(command_queue_test, multiple_queues_branches) {
+    engine_configuration configuration =
+        engine_configuration(
+            false,          // profiling
+            false,          // decorate_kernel_names
+            false,          // dump_custom_program
+            "",             // options
+            "",             // single_kernel
+            true,           // primitives_parallelisation
+            "",             // engine_log
+            "",             // sources_dumps_dir
+            priority_mode_types::disabled,
+            throttle_mode_types::disabled,
+            true,           // memory_pool
+            nullptr,        // context
+            "cache.json",   // tuning_cache_path
+            "",             // kernels_cache_dir
+            1,              // n_threads
+            false,          // memory_planner
+            3);             // n_queues
+    cldnn::engine engine(configuration);
+
+    // input -> (relu -> abs) + (linear -> relu) + abs, three independent branches joined by eltwise
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    std::vector<float> input_vec = { -2.f, -1.f, 0.f, 1.f, 2.f, 3.f, -3.f, 4.f };
+    set_values(input, input_vec);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu1", "input", activation_relu));
+    topology.add(activation("abs1", "relu1", activation_abs));
+    topology.add(activation("linear2", "input", activation_linear, cldnn_activation_additional_params{ 2.f, 1.f }));
+    topology.add(activation("relu2", "linear2", activation_relu));
+    topology.add(activation("abs3", "input", activation_abs));
+    topology.add(eltwise("sum", { "abs1", "relu2", "abs3" }, eltwise_mode::sum));
+
+    network network(engine, topology);
+    for (int iteration = 0; iteration < 3; iteration++)
+    {
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output_ptr = outputs.at("sum").get_memory().pointer<float>();
+        for (size_t i = 0; i < input_vec.size(); i++)
+        {
+            float x = input_vec[i];
+            float expected = std::max(x, 0.f) + std::max(2.f * x + 1.f, 0.f) + std::abs(x);
+            EXPECT_FLOAT_EQ(output_ptr[i], expected);
+        }
+    }
+}
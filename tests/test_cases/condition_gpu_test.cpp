@@ -23,6 +23,7 @@
 #include <api/CPP/network.hpp>
 #include <api/CPP/pooling.hpp>
 #include <api/CPP/condition.hpp>
+#include <api/CPP/convolution.hpp>
 #include <api/CPP/softmax.hpp>
 #include <api/CPP/scale.hpp>
 #include <api/CPP/data.hpp>
@@ -503,6 +504,57 @@ TEST(condition_gpu, basic_nested_ifs) {
 }
 
 
+TEST(condition_gpu, padded_output) {
+    // the convolution needs padded input, so the branch output is copied into the padded output of the condition
+    const auto& engine = get_test_engine();
+    build_options bs;
+    bs.set_option(build_option::optimize_data(true));
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 8, 1 } });
+    auto compare = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 3, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+    set_values(input, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f });
+    set_values(weights, { 1.0f, 1.0f, 1.0f });
+    set_values(biases, { 0.0f });
+
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout())
+    );
+    topology.add(
+        input_layout("compare", compare.get_layout())
+    );
+    topology.add(
+        data("weights", weights)
+    );
+    topology.add(
+        data("biases", biases)
+    );
+    topology.add(
+        condition("condi", "input", generate_simple_branch(true, "condi"), generate_simple_branch(false, "condi"), "compare", cond_functions::EQUAL)
+    );
+    topology.add(
+        convolution("output", "condi", { "weights" }, { "biases" }, { 1, 1, 1, 1 }, { 0, 0, -1, 0 })
+    );
+
+    network net(engine, topology, bs);
+    net.set_input_data("input", input);
+
+    // both branches are executed twice, so events of the previous executions are reused
+    for (int i = 0; i < 2; i++)
+    {
+        set_values(compare, { 1.0f });
+        net.set_input_data("compare", compare);
+        auto out = net.execute();
+        EXPECT_TRUE(is_output_equal(out.at("output").get_memory(), { 6.0f, 12.0f, 18.0f, 14.0f }));
+
+        set_values(compare, { 4.0f });
+        net.set_input_data("compare", compare);
+        out = net.execute();
+        EXPECT_TRUE(is_output_equal(out.at("output").get_memory(), { 5.0f, 10.5f, 16.5f, 13.0f }));
+    }
+}
+
 TEST(condition_gpu, negative_compare_wrong_layout) {
     const auto& engine = get_test_engine();
     build_options bs;
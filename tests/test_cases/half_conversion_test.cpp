@@ -0,0 +1,120 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/cldnn_defs.h>
+
+#include "test_utils/test_utils.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    uint32_t float_bits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+TEST(half_conversion, bulk_half_to_float_matches_scalar)
+{
+    std::vector<half_t> src;
+    for (uint32_t i = 0; i <= 0xFFFF; i++)
+        src.push_back(half_t(static_cast<uint16_t>(i)));
+
+    // odd count to cover the tail
+    std::vector<float> dst(src.size() - 3);
+    half_to_float(src.data(), dst.data(), dst.size());
+
+    for (size_t i = 0; i < dst.size(); i++)
+        EXPECT_EQ(float_bits(dst[i]), float_bits(static_cast<float>(src[i]))) << "half 0x" << std::hex << i;
+}
+
+TEST(half_conversion, bulk_float_to_half_matches_scalar)
+{
+    // normal and subnormal halves, values out of half range and special values
+    auto src = generate_random_1d<float>(100003, -70000, 70000, 1 << 14);
+    auto small = generate_random_1d<float>(1000, -1, 1, 1 << 20);
+    for (auto& value : small)
+        value *= 1e-4f;
+    src.insert(src.end(), small.begin(), small.end());
+    for (float value : { 0.f, -0.f, 65504.f, 65520.f, 1e-8f, -6.1e-5f, INFINITY, -INFINITY })
+        src.push_back(value);
+
+    std::vector<half_t> dst(src.size());
+    float_to_half(src.data(), dst.data(), dst.size());
+
+    for (size_t i = 0; i < src.size(); i++)
+        EXPECT_EQ(static_cast<uint16_t>(dst[i]), static_cast<uint16_t>(half_t(src[i]))) << "value " << src[i];
+}
+
+TEST(half_conversion, nans_and_infinities)
+{
+    // NaNs are quieted and keep (the upper bits of) their payload, bulk conversions of 8 values (F16C)
+    // and of 4 values give the same results as the scalar ones
+    const std::vector<std::pair<uint32_t, uint16_t>> cases = {
+        { 0x7F800000, 0x7C00 }, { 0xFF800000, 0xFC00 },
+        { 0x7FC00000, 0x7E00 }, { 0xFFC00000, 0xFE00 },
+        { 0x7F800001, 0x7E00 }, { 0x7FC02000, 0x7E01 },
+        { 0x7F802000, 0x7E01 }, { 0x7FFFFFFF, 0x7FFF },
+    };
+    const std::vector<std::pair<uint16_t, uint32_t>> half_cases = {
+        { 0x7C00, 0x7F800000 }, { 0xFC00, 0xFF800000 },
+        { 0x7E00, 0x7FC00000 }, { 0xFE00, 0xFFC00000 },
+        { 0x7C01, 0x7FC02000 }, { 0xFC01, 0xFFC02000 },
+        { 0x7D55, 0x7FEAA000 }, { 0x7FFF, 0x7FFFE000 },
+    };
+
+    std::vector<float> floats;
+    for (const auto& c : cases)
+    {
+        float value;
+        std::memcpy(&value, &c.first, sizeof(value));
+        floats.push_back(value);
+    }
+    for (size_t count : { cases.size(), size_t(4), size_t(1) })
+    {
+        std::vector<half_t> halves(count);
+        float_to_half(floats.data(), halves.data(), count);
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(static_cast<uint16_t>(halves[i]), cases[i].second) << "float 0x" << std::hex << cases[i].first;
+            EXPECT_EQ(static_cast<uint16_t>(half_t(floats[i])), cases[i].second) << "float 0x" << std::hex << cases[i].first;
+        }
+    }
+
+    std::vector<half_t> halves;
+    for (const auto& c : half_cases)
+        halves.push_back(half_t(c.first));
+    for (size_t count : { half_cases.size(), size_t(4), size_t(1) })
+    {
+        std::vector<float> values(count);
+        half_to_float(halves.data(), values.data(), count);
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(float_bits(values[i]), half_cases[i].second) << "half 0x" << std::hex << half_cases[i].first;
+            EXPECT_EQ(float_bits(static_cast<float>(halves[i])), half_cases[i].second) << "half 0x" << std::hex << half_cases[i].first;
+        }
+    }
+}
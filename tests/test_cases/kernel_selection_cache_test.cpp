@@ -0,0 +1,98 @@
+/*
+// Copyright (c) 2016 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/data.hpp>
+
+#include "test_utils/test_utils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    std::vector<float> run_network(const engine& engine, const topology& topology, const build_options& options, const memory& input)
+    {
+        network network(engine, topology, options);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        auto output_ptr = outputs.at("pool").get_memory().pointer<float>();
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    }
+
+    std::string read_file(const std::string& file_name)
+    {
+        std::ifstream file(file_name, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
+
+TEST(kernel_selection_cache, exported_selection_is_imported_by_next_build)
+{
+    const auto& engine = get_test_engine();
+    const std::string cache_file = "kernel_selection_cache_test.bin";
+    std::remove(cache_file.c_str());
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 3, 16, 16 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 8, 3, 3, 3 } });
+    set_values(input, generate_random_1d<float>(3 * 16 * 16, -1, 1));
+    set_values(weights, generate_random_1d<float>(8 * 3 * 3 * 3, -1, 1));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        convolution("conv", "input", { "weights" }),
+        activation("relu", "conv", activation_relu),
+        pooling("pool", "relu", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    auto reference = run_network(engine, topology, options, input);
+
+    options.set_option(build_option::kernel_selection_cache(cache_file));
+    auto exported = run_network(engine, topology, options, input);
+    auto exported_cache = read_file(cache_file);
+    ASSERT_FALSE(exported_cache.empty());
+
+    // the importing build selects the same kernels, so the cache stays the same
+    auto imported = run_network(engine, topology, options, input);
+    EXPECT_EQ(read_file(cache_file), exported_cache);
+
+    ASSERT_EQ(reference.size(), exported.size());
+    ASSERT_EQ(reference.size(), imported.size());
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        EXPECT_FLOAT_EQ(reference[i], exported[i]);
+        EXPECT_FLOAT_EQ(reference[i], imported[i]);
+    }
+
+    std::remove(cache_file.c_str());
+}
@@ -1823,6 +1823,98 @@ TEST(lstm_gpu, generic_lstm_stacked_seq_bi_f32) {
     generic_lstm_gpu_test<float>(4, 7, 2, 3, 3, 2, true, true, true);
 }
 
+// the first of stacked layers is unrolled with the input projection of all the steps computed at once
+TEST(lstm_gpu, generic_lstm_long_seq_f32) {
+    generic_lstm_gpu_test<float>(2, 200, 1, 1, 8, 8, true, false, false);
+}
+
+TEST(lstm_gpu, generic_lstm_long_seq_bi_f32) {
+    generic_lstm_gpu_test<float>(2, 200, 2, 2, 8, 8, true, true, true);
+}
+
+// a layer without stacked lstm users runs as a single kernel when the data is optimized,
+// the same topology without optimizations is unrolled into lstm_gemm and lstm_elt steps
+void lstm_sequence_single_kernel_test(int batch_size, int sequence_len, int input_size, int hidden_size, int directions,
+                                      bool has_bias, bool has_hidden, bool has_cell, cldnn_lstm_output output_selection) {
+    const auto& engine = get_test_engine();
+
+    memory input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, sequence_len, input_size, 1 } });
+    memory weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, directions, input_size, 4 * hidden_size } });
+    memory recurrent = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, directions, hidden_size, 4 * hidden_size } });
+    memory bias = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4 * hidden_size, directions } });
+    memory hidden = memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, 1, hidden_size, directions } });
+    memory cell = memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, 1, hidden_size, directions } });
+    set_values(input, generate_random_1d<float>(batch_size * sequence_len * input_size, -2, 2));
+    set_values(weights, generate_random_1d<float>(directions * 4 * hidden_size * input_size, -2, 2));
+    set_values(recurrent, generate_random_1d<float>(directions * 4 * hidden_size * hidden_size, -2, 2));
+    set_values(bias, generate_random_1d<float>(directions * 4 * hidden_size, -2, 2));
+    set_values(hidden, generate_random_1d<float>(batch_size * directions * hidden_size, -2, 2));
+    set_values(cell, generate_random_1d<float>(batch_size * directions * hidden_size, -2, 2));
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(data("recurrent", recurrent));
+    if (has_bias)
+        topology.add(data("bias", bias));
+    if (has_hidden)
+        topology.add(input_layout("hidden", hidden.get_layout()));
+    if (has_cell)
+        topology.add(input_layout("cell", cell.get_layout()));
+    topology.add(lstm("lstm", { "input" }, "weights", "recurrent", has_bias ? "bias" : "", has_hidden ? "hidden" : "",
+                      has_cell ? "cell" : "", "", 0, false, {}, {}, output_selection, default_offset_type));
+
+    auto execute = [&](bool optimize_data) {
+        build_options options;
+        options.set_option(build_option::optimize_data(optimize_data));
+        network network(engine, topology, options);
+        network.set_input_data("input", input);
+        if (has_hidden)
+            network.set_input_data("hidden", hidden);
+        if (has_cell)
+            network.set_input_data("cell", cell);
+        auto outputs = network.execute();
+
+        bool unrolled = false;
+        for (auto& id : network.get_all_primitive_org_ids())
+        {
+            if (id.find(":lstm_gemm") != std::string::npos || id.find(":lstm_elt") != std::string::npos)
+                unrolled = true;
+        }
+        EXPECT_EQ(unrolled, !optimize_data);
+
+        EXPECT_EQ(outputs.size(), size_t(1));
+        return outputs.begin()->second.get_memory();
+    };
+
+    auto single_kernel_output = execute(true);
+    auto unrolled_output = execute(false);
+
+    ASSERT_EQ(single_kernel_output.get_layout().size, unrolled_output.get_layout().size);
+    auto single_kernel_ptr = single_kernel_output.pointer<float>();
+    auto unrolled_ptr = unrolled_output.pointer<float>();
+    for (size_t i = 0; i < unrolled_output.get_layout().count(); ++i)
+    {
+        ASSERT_NEAR(single_kernel_ptr[i], unrolled_ptr[i], 1e-3f) << "i = " << i;
+    }
+}
+
+TEST(lstm_gpu, lstm_sequence_single_kernel_f32) {
+    lstm_sequence_single_kernel_test(2, 5, 3, 4, 2, false, false, false, cldnn_lstm_output_hidden_cell);
+}
+
+TEST(lstm_gpu, lstm_sequence_single_kernel_bias_hidden_cell_f32) {
+    lstm_sequence_single_kernel_test(3, 7, 5, 8, 1, true, true, true, cldnn_lstm_output_hidden);
+}
+
+TEST(lstm_gpu, lstm_sequence_single_kernel_bi_bias_hidden_cell_f32) {
+    lstm_sequence_single_kernel_test(2, 7, 3, 4, 2, true, true, true, cldnn_lstm_output_sequence_cell);
+}
+
+TEST(lstm_gpu, lstm_sequence_single_kernel_long_seq_f32) {
+    lstm_sequence_single_kernel_test(1, 200, 8, 8, 1, true, false, false, cldnn_lstm_output_sequence);
+}
+
 // optional outputs support
 TEST(lstm_gpu, output_test_sequence_f32) {
     lstm_gpu_output_test<float>(cldnn_lstm_output::cldnn_lstm_output_sequence, 1);
@@ -29,6 +29,7 @@
 #include <api/CPP/reshape.hpp>
 #include <api/CPP/crop.hpp>
 #include <api/CPP/scale.hpp>
+#include <api/CPP/eltwise.hpp>
 
 #include "test_utils/test_utils.h"
 
@@ -565,4 +566,157 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[1], 6.0f);
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
-}
\ No newline at end of file
+}
+TEST(memory_pool, memory_planner_multi_outputs_network) {
+    //            -- relu -- relu1 -- relu4
+    //     input<
+    //            -- relu2 --  relu3 -- relu5--relu6--relu7
+    // results with buffers planned into arenas have to match the ones computed with pooled buffers
+    auto input_layout1 = layout{ data_types::f32, format::bfyx,{ 1, 4, 4, 4 } };
+
+    topology topology;
+    topology.add(input_layout("input", input_layout1));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(activation("relu1", "relu", activation_linear, { 2.0f, 1.0f }));
+    topology.add(activation("relu2", "input", activation_abs));
+    topology.add(activation("relu3", "relu2", activation_linear, { 0.5f, -1.0f }));
+    topology.add(activation("relu4", "relu1", activation_relu));
+    topology.add(activation("relu5", "relu3", activation_square));
+    topology.add(activation("relu6", "relu5", activation_relu));
+    topology.add(activation("relu7", "relu6", activation_linear, { 1.0f, 3.0f }));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    std::vector<float> input_vec(64);
+    for (size_t i = 0; i < input_vec.size(); ++i)
+        input_vec[i] = static_cast<float>(i % 7) - 3.0f;
+
+    std::map<bool, std::vector<float>> results;
+    for (bool planner : { false, true })
+    {
+        engine_configuration cfg{ false, false, false, std::string(), std::string(), true, std::string(), std::string(),
+                                  priority_mode_types::disabled, throttle_mode_types::disabled, true /*mem_pool*/, nullptr,
+                                  "cache.json", std::string(), 1, planner };
+        engine engine{ cfg };
+        auto input = memory::allocate(engine, input_layout1);
+        set_values(input, input_vec);
+
+        network network(engine, topology, bo);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        for (auto output : { "relu4", "relu7" })
+        {
+            auto ptr = outputs.at(output).get_memory().pointer<float>();
+            results[planner].insert(results[planner].end(), ptr.begin(), ptr.end());
+        }
+    }
+
+    ASSERT_EQ(results[false].size(), results[true].size());
+    for (size_t i = 0; i < results[false].size(); ++i)
+        EXPECT_EQ(results[false][i], results[true][i]) << "at index " << i;
+}
+
+TEST(memory_pool, in_place_activation_and_eltwise)
+{
+    // act1 -> act2 -> sum chain can be computed in one buffer, otherwise the pool needs two of them
+    layout lay = { data_types::f32, format::bfyx, { 1, 8, 16, 16 } };
+    std::vector<float> values = generate_random_1d<float>(lay.count(), -1, 1);
+
+    topology topo(
+        input_layout("input", lay),
+        activation("act1", "input", activation_relu),
+        activation("act2", "act1", activation_linear, { 2.f, 1.f }),
+        eltwise("sum", { "act2", "input" }, eltwise_mode::sum),
+        activation("out", "sum", activation_linear, { 1.f, 0.f }));
+
+    std::map<bool, uint64_t> max_used_memory;
+    for (bool optimize_data : { false, true })
+    {
+        engine_configuration cfg{ false, false, false, std::string(), std::string(), false /*oooq*/, std::string(),std::string(), priority_mode_types::disabled, throttle_mode_types::disabled, true /*mem_pool*/ };
+        engine engine{ cfg };
+        auto input = memory::allocate(engine, lay);
+        set_values(input, values);
+
+        build_options bo;
+        bo.set_option(build_option::optimize_data(optimize_data));
+        network net(engine, topo, bo);
+        net.set_input_data("input", input);
+        auto output = net.execute().at("out").get_memory();
+
+        auto ptr = output.pointer<float>(lock_mode::read);
+        for (size_t i = 0; i < values.size(); ++i)
+            EXPECT_FLOAT_EQ(ptr[i], 2.f * std::max(values[i], 0.f) + 1.f + values[i]) << "at index " << i;
+        max_used_memory[optimize_data] = engine.get_max_used_device_memory_size();
+    }
+
+    EXPECT_LT(max_used_memory[true], max_used_memory[false]);
+}
+
+TEST(memory_tests, host_memory_as_network_input_and_output_read)
+{
+    engine engine;
+    layout lay = { data_types::f32, format::bfyx, { 1, 2, 4, 4 } };
+    std::vector<float> values = generate_random_1d<float>(lay.count(), -1, 1);
+
+    // user buffer has to outlive the memory attached to it
+    auto user_buffer = static_cast<float*>(_mm_malloc(lay.bytes_count(), 4096));
+    std::copy(values.begin(), values.end(), user_buffer);
+    {
+        auto host_input = memory::allocate_host(engine, lay);
+        {
+            auto ptr = host_input.pointer<float>(lock_mode::write);
+            std::copy(values.begin(), values.end(), ptr.begin());
+        }
+        auto attached_input = memory::attach_host(engine, lay, user_buffer, lay.count());
+        EXPECT_TRUE(attached_input.is_allocated_by(engine));
+        EXPECT_THROW(memory::attach_host(engine, lay, user_buffer + 1, lay.count()), std::exception);
+
+        topology topo(
+            input_layout("input", lay),
+            activation("relu", "input", activation_relu));
+
+        network net(engine, topo);
+        for (auto& input : { host_input, attached_input })
+        {
+            net.set_input_data("input", input);
+            auto output = net.execute().at("relu").get_memory();
+            auto ptr = output.pointer<float>(lock_mode::read);
+            for (size_t i = 0; i < values.size(); ++i)
+                EXPECT_EQ(ptr[i], std::max(values[i], 0.f)) << "at index " << i;
+        }
+    }
+    _mm_free(user_buffer);
+}
+
+TEST(memory_tests, host_memory_as_network_output)
+{
+    engine engine;
+    layout lay = { data_types::f32, format::bfyx, { 1, 2, 4, 4 } };
+    std::vector<float> values = generate_random_1d<float>(lay.count(), -1, 1);
+    auto input = memory::allocate(engine, lay);
+    set_values(input, values);
+
+    topology topo(
+        input_layout("input", lay),
+        activation("relu", "input", activation_relu));
+
+    network net(engine, topo);
+    net.set_input_data("input", input);
+
+    // the output is written directly into the host memory, on every execution
+    auto host_output = memory::allocate_host(engine, lay);
+    net.set_output_memory("relu", host_output);
+    for (int i = 0; i < 2; ++i)
+    {
+        auto output = net.execute().at("relu").get_memory();
+        EXPECT_TRUE(output.is_the_same_buffer(host_output));
+        auto ptr = host_output.pointer<float>(lock_mode::read);
+        for (size_t j = 0; j < values.size(); ++j)
+            EXPECT_EQ(ptr[j], std::max(values[j], 0.f)) << "at index " << j;
+    }
+
+    EXPECT_THROW(net.set_output_memory("input", host_output), std::exception);
+    EXPECT_THROW(net.set_output_memory("relu", memory::allocate_host(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 4 } })), std::exception);
+}
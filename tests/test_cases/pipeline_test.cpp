@@ -0,0 +1,115 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/pipeline.hpp>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/eltwise.hpp>
+#include "test_utils/test_utils.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    // out = relu(2 * in + 1) + |in|
+    topology make_pipeline_topology(const layout& input_layout_desc)
+    {
+        topology topology;
+        topology.add(input_layout("input", input_layout_desc));
+        topology.add(activation("linear", "input", activation_linear, cldnn_activation_additional_params{ 2.f, 1.f }));
+        topology.add(activation("relu", "linear", activation_relu));
+        topology.add(activation("abs", "input", activation_abs));
+        topology.add(eltwise("sum", { "relu", "abs" }, eltwise_mode::sum));
+        return topology;
+    }
+
+    float expected_output(float x)
+    {
+        return std::max(2.f * x + 1.f, 0.f) + std::abs(x);
+    }
+}
+
+TEST(pipeline, requests_in_flight)
+{
+    const auto& engine = get_test_engine();
+    layout input_layout_desc(data_types::f32, format::bfyx, { 1, 4, 8, 8 });
+    program prog(engine, make_pipeline_topology(input_layout_desc));
+    pipeline pipe(prog, 3);
+
+    auto count = input_layout_desc.count();
+    EXPECT_EQ(pipe.get_layout("input").count(), count);
+    EXPECT_EQ(pipe.get_layout("sum").count(), count);
+
+    const size_t requests_num = 8;
+    std::vector<std::vector<float>> inputs(requests_num), outputs(requests_num, std::vector<float>(count));
+    std::vector<std::future<void>> results;
+    for (size_t r = 0; r < requests_num; ++r)
+    {
+        inputs[r] = generate_random_1d<float>(count, -10, 10);
+        results.push_back(pipe.submit({ { "input", inputs[r].data() } }, { { "sum", outputs[r].data() } }));
+    }
+
+    for (size_t r = 0; r < requests_num; ++r)
+    {
+        results[r].get();
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_FLOAT_EQ(outputs[r][i], expected_output(inputs[r][i])) << "request " << r << " element " << i;
+    }
+}
+
+TEST(pipeline, input_reused_after_submit)
+{
+    const auto& engine = get_test_engine();
+    layout input_layout_desc(data_types::f32, format::bfyx, { 1, 1, 4, 4 });
+    pipeline pipe(engine, make_pipeline_topology(input_layout_desc));
+
+    auto count = input_layout_desc.count();
+    std::vector<float> input(count, 1.f), output1(count), output2(count);
+    auto result1 = pipe.submit({ { "input", input.data() } }, { { "sum", output1.data() } });
+    std::fill(input.begin(), input.end(), -1.f);
+    auto result2 = pipe.submit({ { "input", input.data() } }, { { "sum", output2.data() } });
+    pipe.wait();
+
+    result1.get();
+    result2.get();
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_FLOAT_EQ(output1[i], expected_output(1.f));
+        EXPECT_FLOAT_EQ(output2[i], expected_output(-1.f));
+    }
+}
+
+TEST(pipeline, unknown_output)
+{
+    const auto& engine = get_test_engine();
+    layout input_layout_desc(data_types::f32, format::bfyx, { 1, 1, 4, 4 });
+    pipeline pipe(engine, make_pipeline_topology(input_layout_desc));
+
+    std::vector<float> input(input_layout_desc.count()), output(input_layout_desc.count());
+    EXPECT_ANY_THROW(pipe.submit({ { "input", input.data() } }, { { "relu", output.data() } }));
+
+    // slot of failed request is released
+    pipe.submit({ { "input", input.data() } }, { { "sum", output.data() } }).get();
+}
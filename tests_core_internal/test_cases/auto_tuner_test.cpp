@@ -0,0 +1,66 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <cstdio>
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "auto_tuner.h"
+
+using namespace kernel_selector;
+
+namespace
+{
+    std::tuple<std::string, int> kernel(const std::string& name, int tune_index)
+    {
+        return std::make_tuple(name, tune_index);
+    }
+}
+
+TEST(auto_tuner, flush_keeps_entries_of_other_writers)
+{
+    const std::string cache_path = "auto_tuner_flush_test.json";
+    std::remove(cache_path.c_str());
+
+    // two tuners loaded the same file, as two processes tuning at the same time
+    AutoTuner first, second;
+    first.StoreKernel(cache_path, "1", "kernel_a", 1, 24);
+    second.StoreKernel(cache_path, "2", "kernel_b", 2, 24);
+    first.FlushOnlineCache();
+    second.FlushOnlineCache();
+
+    {
+        AutoTuner reader;
+        EXPECT_EQ(reader.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, "1"), kernel("kernel_a", 1));
+        EXPECT_EQ(reader.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, "2"), kernel("kernel_b", 2));
+    }
+
+    // entries of the other writer are visible after the flush, own entries replace the stored ones
+    EXPECT_EQ(second.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, "1"), kernel("kernel_a", 1));
+    second.StoreKernel(cache_path, "1", "kernel_c", 3, 24);
+    second.StoreKernel(cache_path, "3", "kernel_d", 4, 12);
+    second.FlushOnlineCache();
+
+    {
+        AutoTuner reader;
+        EXPECT_EQ(reader.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, "1"), kernel("kernel_c", 3));
+        EXPECT_EQ(reader.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, "2"), kernel("kernel_b", 2));
+        EXPECT_EQ(reader.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 12, "3"), kernel("kernel_d", 4));
+    }
+    std::remove(cache_path.c_str());
+}
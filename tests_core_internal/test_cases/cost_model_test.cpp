@@ -0,0 +1,119 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "cost_model.h"
+#include "convolution/convolution_params.h"
+
+using namespace kernel_selector;
+
+namespace
+{
+    const char* model_path = "cost_model_test.model";
+
+    // two candidates of the same kernel, the first one is faster for small outputs, the second one for big ones
+    void write_model(const std::string& header, uint32_t samples = 10)
+    {
+        std::ofstream file(model_path);
+        file << header << "\n";
+        const float fixed[] = { 10.f, 12.f };
+        const float slope[] = { 0.5f, 0.2f };
+        for (int candidate = 0; candidate < 2; candidate++)
+        {
+            file << "convolution_gpu_test " << candidate << " " << samples;
+            for (int i = 0; i < CostModel::FEATURES_COUNT; i++)
+                file << " " << (i == CostModel::BIAS ? fixed[candidate] : i == CostModel::OUTPUT_X ? slope[candidate] : 0.f);
+            file << "\n";
+        }
+    }
+
+    std::vector<float> features_with_output_x(float value)
+    {
+        std::vector<float> features(CostModel::FEATURES_COUNT, 0.f);
+        features[CostModel::BIAS] = 1.f;
+        features[CostModel::OUTPUT_X] = value;
+        return features;
+    }
+
+    std::string valid_header()
+    {
+        std::stringstream header;
+        header << "CLDNN_COST_MODEL " << CostModel::version << " " << CostModel::FEATURES_COUNT;
+        return header.str();
+    }
+}
+
+TEST(cost_model, ranks_candidates_by_predicted_time)
+{
+    write_model(valid_header());
+    CostModel model;
+    ASSERT_TRUE(model.Load(model_path));
+    std::remove(model_path);
+
+    auto small = model.Rank("convolution_gpu_test", features_with_output_x(2.f));
+    ASSERT_EQ(small.size(), 2u);
+    EXPECT_EQ(small[0].tuneIndex, 0);
+    EXPECT_FLOAT_EQ(small[0].predictedTime, 11.f);
+
+    auto big = model.Rank("convolution_gpu_test", features_with_output_x(10.f));
+    ASSERT_EQ(big.size(), 2u);
+    EXPECT_EQ(big[0].tuneIndex, 1);
+    EXPECT_LT(big[0].predictedTime, big[1].predictedTime);
+
+    EXPECT_TRUE(model.Rank("convolution_gpu_unknown", features_with_output_x(2.f)).empty());
+    EXPECT_TRUE(model.Rank("convolution_gpu_test", { 1.f }).empty());
+}
+
+TEST(cost_model, rejects_invalid_files)
+{
+    CostModel model;
+    EXPECT_FALSE(model.Load("cost_model_test.missing"));
+
+    write_model("CLDNN_COST_MODEL 1 3");
+    EXPECT_FALSE(model.Load(model_path));
+
+    // candidates with too few training samples are not used
+    write_model(valid_header(), 1);
+    EXPECT_TRUE(model.Load(model_path));
+    EXPECT_TRUE(model.Rank("convolution_gpu_test", features_with_output_x(2.f)).empty());
+    std::remove(model_path);
+}
+
+TEST(cost_model, features_of_convolution)
+{
+    convolution_params params;
+    params.output = DataTensor({ 7, 7, 64, 1 }, Datatype::F16, DataLayout::bfyx);
+    params.inputs[0] = DataTensor({ 14, 14, 32, 1 }, Datatype::F16, DataLayout::bfyx);
+    params.filterSize = { 3, 3, 1 };
+    params.stride = { 2, 2, 1 };
+    params.engineInfo.computeUnitsCount = 24;
+
+    auto features = CostModel::GetFeatures(params);
+    ASSERT_EQ(features.size(), static_cast<size_t>(CostModel::FEATURES_COUNT));
+    EXPECT_EQ(features[CostModel::BIAS], 1.f);
+    EXPECT_EQ(features[CostModel::OUTPUT_X], 3.f);
+    EXPECT_EQ(features[CostModel::INPUT_F], std::log2(33.f));
+    EXPECT_EQ(features[CostModel::STRIDE_X], std::log2(3.f));
+    EXPECT_EQ(features[CostModel::DATA_TYPE_F16], 1.f);
+    EXPECT_EQ(features[CostModel::LAYOUT_BFYX], 1.f);
+    EXPECT_EQ(features[CostModel::LAYOUT_OTHER], 0.f);
+}
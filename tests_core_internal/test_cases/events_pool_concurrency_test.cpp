@@ -0,0 +1,120 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <atomic>
+#include <set>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "engine_impl.h"
+#include "ocl_toolkit.h"
+#include "ocl_base_event.h"
+#include "ocl_user_event.h"
+#include "events_pool.h"
+
+#include "test_utils.h"
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace
+{
+    const size_t threads_count = 8;
+    const size_t events_per_thread = 256;
+
+    std::set<event_impl*> acquire_concurrently(gpu::events_pool& pool, std::shared_ptr<gpu::gpu_toolkit> ctx)
+    {
+        std::vector<std::vector<event_impl::ptr>> acquired(threads_count);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                for (size_t i = 0; i < events_per_thread; ++i)
+                    acquired[t].push_back(pool.get_from_user_pool(ctx, true));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        std::set<event_impl*> events;
+        for (const auto& thread_events : acquired)
+        {
+            for (const auto& ev : thread_events)
+            {
+                EXPECT_TRUE(ev->is_valid());
+                events.insert(ev.get());
+            }
+        }
+        return events;
+    }
+}
+
+TEST(events_pool, concurrent_acquire_and_reset)
+{
+    auto ctx = api_cast(get_test_engine().get())->get_context();
+    gpu::events_pool pool;
+
+    // every thread has to get its own events
+    auto first = acquire_concurrently(pool, ctx);
+    EXPECT_EQ(first.size(), threads_count * events_per_thread);
+    EXPECT_EQ(pool.size(), threads_count * events_per_thread);
+
+    // after reset all events are back in the pool and are handed out again instead of allocating new ones
+    pool.reset_events();
+    auto second = acquire_concurrently(pool, ctx);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(pool.size(), threads_count * events_per_thread);
+}
+
+TEST(events_pool, reset_doesnt_affect_events_of_other_owners)
+{
+    auto ctx = api_cast(get_test_engine().get())->get_context();
+    gpu::events_pool pool;
+    gpu::events_owner first_owner, second_owner;
+
+    // events of the first owner are acquired while events of the second one are acquired and reset by another thread,
+    // as when two networks are executed at the same time
+    std::atomic<bool> done{ false };
+    std::thread other_network([&]()
+    {
+        while (!done.load())
+        {
+            for (size_t i = 0; i < 16; ++i)
+                pool.get_from_user_pool(ctx, true, &second_owner);
+            pool.reset_events(second_owner);
+        }
+    });
+
+    std::vector<event_impl::ptr> acquired;
+    for (size_t i = 0; i < threads_count * events_per_thread; ++i)
+        acquired.push_back(pool.get_from_user_pool(ctx, true, &first_owner));
+    done.store(true);
+    other_network.join();
+
+    std::set<event_impl*> events;
+    for (const auto& ev : acquired)
+    {
+        EXPECT_TRUE(ev->is_valid());
+        events.insert(ev.get());
+    }
+    EXPECT_EQ(events.size(), acquired.size());
+
+    pool.reset_events(first_owner);
+    for (const auto& ev : acquired)
+        EXPECT_FALSE(ev->is_valid());
+}
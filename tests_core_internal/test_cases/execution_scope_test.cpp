@@ -0,0 +1,111 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/engine.hpp"
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/network.hpp"
+
+#include "api_impl.h"
+#include "engine_impl.h"
+#include "ocl_toolkit.h"
+#include "ocl_base_event.h"
+#include "ocl_user_event.h"
+#include "events_pool.h"
+
+using namespace cldnn;
+
+TEST(execution_scope, queue_is_selected_by_the_calling_thread)
+{
+    engine_configuration config(false, false, false, "", "", true, "", "", priority_mode_types::disabled, throttle_mode_types::disabled,
+                                true, nullptr, "cache.json", "", 1, false, 2);
+    engine engine(config);
+    auto ctx = api_cast(engine.get())->get_context();
+    ASSERT_EQ(ctx->get_queues_count(), 2);
+
+    gpu::events_owner first_events, second_events;
+    EXPECT_EQ(ctx->get_current_queue(), 0);
+    {
+        gpu::gpu_toolkit::execution_scope scope(*ctx, first_events);
+        scope.set_queue(1);
+        EXPECT_EQ(ctx->get_current_queue(), 1);
+
+        // a network executed by another thread at the same time selects its own queues
+        std::thread other_network([&]()
+        {
+            EXPECT_EQ(ctx->get_current_queue(), 0);
+            gpu::gpu_toolkit::execution_scope other_scope(*ctx, second_events);
+            EXPECT_EQ(ctx->get_current_queue(), 0);
+        });
+        other_network.join();
+        EXPECT_EQ(ctx->get_current_queue(), 1);
+
+        // nested execution (e.g. branch of condition) starts on the queue of the outer one
+        {
+            gpu::gpu_toolkit::execution_scope nested(*ctx, second_events);
+            EXPECT_EQ(ctx->get_current_queue(), 1);
+            nested.set_queue(0);
+            EXPECT_EQ(ctx->get_current_queue(), 0);
+        }
+        EXPECT_EQ(ctx->get_current_queue(), 1);
+    }
+    EXPECT_EQ(ctx->get_current_queue(), 0);
+
+    // execution which ends with an exception doesn't leave its queue selected
+    try
+    {
+        gpu::gpu_toolkit::execution_scope scope(*ctx, first_events);
+        scope.set_queue(1);
+        throw std::runtime_error("failed step");
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+    EXPECT_EQ(ctx->get_current_queue(), 0);
+}
+
+TEST(execution_scope, events_of_nested_network_belong_to_the_outer_execution)
+{
+    engine engine;
+    auto ctx = api_cast(engine.get())->get_context();
+
+    auto input_layout_desc = layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 });
+    auto input = memory::allocate(engine, input_layout_desc);
+    topology topology;
+    topology.add(input_layout("input", input_layout_desc));
+    topology.add(activation("relu", "input", activation_relu));
+    network branch(engine, topology);
+    branch.set_input_data("input", input);
+
+    gpu::events_owner outer_events;
+    {
+        gpu::gpu_toolkit::execution_scope scope(*ctx, outer_events);
+        auto branch_event = api_cast(branch.execute().at("relu").get_event().get());
+        EXPECT_EQ(ctx->get_events_owner(), &outer_events);
+
+        // the event returned by the branch isn't released to the pool, so it isn't reused by the outer network
+        auto next_event = ctx->enqueue_marker({});
+        EXPECT_NE(next_event.get(), branch_event);
+        branch_event->wait();
+    }
+    ctx->reset_events(outer_events);
+    EXPECT_EQ(ctx->get_events_owner(), nullptr);
+}
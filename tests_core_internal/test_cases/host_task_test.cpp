@@ -0,0 +1,66 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/network.hpp"
+
+#include "api_impl.h"
+#include "network_impl.h"
+#include "primitive_gpu_base.h"
+
+using namespace cldnn;
+
+TEST(host_task, runs_on_worker_and_reports_errors)
+{
+    // in-order queue, so host tasks run asynchronously
+    engine engine;
+    auto input_layout_desc = layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 });
+    auto input = memory::allocate(engine, input_layout_desc);
+    topology topology;
+    topology.add(input_layout("input", input_layout_desc));
+    topology.add(activation("relu", "input", activation_relu));
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto inst = api_cast(network.get())->get_primitive("relu");
+
+    // the task waits for the test, which continues only after run_host_task returned
+    std::promise<void> release;
+    auto released = release.get_future();
+    std::promise<std::thread::id> task_thread;
+    auto ev = gpu::run_host_task(*inst, {}, [&]()
+    {
+        if (released.wait_for(std::chrono::seconds(10)) != std::future_status::ready)
+            throw std::runtime_error("host task was run by the caller");
+        task_thread.set_value(std::this_thread::get_id());
+    });
+    release.set_value();
+    ev->wait();
+    EXPECT_NE(task_thread.get_future().get(), std::this_thread::get_id());
+
+    // error of the last host task isn't lost - it is reported by its event and by the next host task
+    auto failed = gpu::run_host_task(*inst, {}, []() { throw std::runtime_error("host task failed"); });
+    EXPECT_THROW(failed->wait(), std::runtime_error);
+    EXPECT_THROW(gpu::run_host_task(*inst, {}, []() {}), std::runtime_error);
+    gpu::run_host_task(*inst, {}, []() {})->wait();
+}
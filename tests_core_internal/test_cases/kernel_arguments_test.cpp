@@ -0,0 +1,81 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/network.hpp"
+
+#include "test_utils.h"
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace
+{
+    const int chain_length = 64;
+
+    // input -> chain_length x (x + 1)
+    topology make_chain_topology()
+    {
+        topology topology;
+        topology.add(input_layout("input", layout(data_types::f32, format::bfyx, { 1, 1, 4, 4 })));
+        primitive_id prev = "input";
+        for (int i = 0; i < chain_length; ++i)
+        {
+            auto id = "add_one_" + std::to_string(i);
+            topology.add(activation(id, prev, activation_linear, { 1.f, 1.f }));
+            prev = id;
+        }
+        return topology;
+    }
+
+    void check_output(network& network, float input_value)
+    {
+        auto output = network.execute().begin()->second.get_memory();
+        auto ptr = output.pointer<float>();
+        for (auto value : ptr)
+            ASSERT_FLOAT_EQ(value, input_value + chain_length);
+    }
+
+}
+
+TEST(kernel_arguments, networks_sharing_program_bind_own_memory)
+{
+    const auto& engine = get_test_engine();
+    program prog(engine, make_chain_topology());
+    network network1(prog), network2(prog);
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 4 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 4 } });
+    set_values(input1, std::vector<float>(16, 1.f));
+    set_values(input2, std::vector<float>(16, 10.f));
+    network1.set_input_data("input", input1);
+    network2.set_input_data("input", input2);
+
+    // both networks use the same kernels, arguments have to follow the executed network
+    for (int i = 0; i < 3; ++i)
+    {
+        check_output(network1, 1.f);
+        check_output(network2, 10.f);
+    }
+
+    // new input is picked up by the first kernel of the chain
+    network1.set_input_data("input", input2);
+    check_output(network1, 10.f);
+    check_output(network1, 10.f);
+}
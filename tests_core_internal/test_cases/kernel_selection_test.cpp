@@ -0,0 +1,160 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/convolution.hpp"
+#include "api/CPP/data.hpp"
+#include "program_impl.h"
+#include "engine_impl.h"
+#include "convolution_inst.h"
+#include "kernel_selector_helper.h"
+#include "kernel_base.h"
+#include "convolution/convolution_kernel_selector.h"
+#include "convolution/convolution_params.h"
+
+#include "test_utils.h"
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace
+{
+    // gives access to the naive selection and to the selection as it was done before priorities were estimated
+    class test_convolution_kernel_selector : public kernel_selector::convolution_kernel_selector
+    {
+    public:
+        kernel_selector::KernelsData select(const kernel_selector::Params& params, const kernel_selector::optional_params& options) const
+        {
+            return GetNaiveBestKernel(params, options, kernel_selector::KernelType::CONVOLUTION);
+        }
+
+        // generates kernels of all the matching implementations and keeps the one with the lowest estimated time
+        kernel_selector::KernelsData select_exhaustive(const kernel_selector::Params& params, const kernel_selector::optional_params& options) const
+        {
+            kernel_selector::KernelsData best;
+            const auto requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
+            for (const auto& implementation : implementations)
+            {
+                if (!implementation->GetSupportedKey().Support(requireKey))
+                    continue;
+                try
+                {
+                    auto kds = implementation->GetKernelsData(params, options);
+                    if (kds.size() && kds[0].kernels.size() && (best.empty() || kds[0].estimatedTime < best[0].estimatedTime))
+                    {
+                        best = kds;
+                        best[0].kernelName = implementation->GetName();
+                    }
+                }
+                catch (std::runtime_error&)
+                {
+                }
+            }
+            return best;
+        }
+    };
+
+    kernel_selector::convolution_params get_conv_params(const convolution_node& node)
+    {
+        const auto& primitive = node.get_primitive();
+        const auto& weights_size = node.weights(0).get_output_layout().size;
+
+        auto params = get_weights_bias_default_params<kernel_selector::convolution_params>(node);
+        params.split = primitive->split();
+        params.filterSize = { (uint32_t)weights_size.spatial[0], (uint32_t)weights_size.spatial[1], (uint32_t)weights_size.spatial[2] };
+        params.padding = { (uint32_t)std::max(-primitive->input_offset.spatial[0], 0),
+                           (uint32_t)std::max(-primitive->input_offset.spatial[1], 0),
+                           (uint32_t)std::max(-primitive->input_offset.spatial[2], 0) };
+        params.stride = { (uint32_t)primitive->stride.spatial[0], (uint32_t)primitive->stride.spatial[1], (uint32_t)primitive->stride.spatial[2] };
+        params.dilation = { 1, 1, 1 };
+        return params;
+    }
+
+    // resnet-like layers: 7x7 stem, 1x1 and 3x3 convolutions with and without stride
+    topology make_conv_topology(const engine& engine, data_types dt, format fmt)
+    {
+        struct conv_desc { int ifm, ofm, size, k, stride; };
+        const conv_desc convs[] = {
+            { 3, 64, 224, 7, 2 }, { 64, 64, 56, 1, 1 }, { 64, 64, 56, 3, 1 }, { 64, 256, 56, 1, 1 },
+            { 256, 128, 56, 1, 2 }, { 128, 128, 28, 3, 1 }, { 128, 512, 28, 1, 1 }, { 512, 256, 28, 1, 2 },
+            { 256, 256, 14, 3, 1 }, { 256, 1024, 14, 1, 1 }, { 1024, 512, 14, 1, 2 }, { 512, 512, 7, 3, 1 },
+        };
+
+        topology topology;
+        int idx = 0;
+        for (const auto& c : convs)
+        {
+            auto id = std::to_string(idx++);
+            auto weights = memory::allocate(engine, { dt, format::bfyx, { c.ofm, c.ifm, c.k, c.k } });
+            auto bias = memory::allocate(engine, { dt, format::bfyx, { 1, 1, c.ofm, 1 } });
+            topology.add(input_layout("input" + id, layout(dt, fmt, { 1, c.ifm, c.size, c.size })));
+            topology.add(data("weights" + id, weights));
+            topology.add(data("bias" + id, bias));
+            topology.add(convolution("conv" + id, "input" + id, { "weights" + id }, { "bias" + id },
+                                     { 1, 1, c.stride, c.stride }, { 0, 0, -(c.k / 2), -(c.k / 2) }));
+        }
+        return topology;
+    }
+
+    void compare_selection(data_types dt, format fmt)
+    {
+        const auto& engine = get_test_engine();
+        build_options build_opt;
+        auto topology = make_conv_topology(engine, dt, fmt);
+        program_impl::ptr prog = api_cast(engine.get())->build_program(*api_cast(topology.get()), build_opt, false, true);
+
+        test_convolution_kernel_selector selector;
+        int layers = 0;
+        for (auto node : prog->get_processing_order())
+        {
+            if (!node->is_type<convolution>())
+                continue;
+
+            auto params = get_conv_params(node->as<convolution>());
+            auto options = get_default_weights_bias_optional_params<kernel_selector::convolution_optional_params>(*prog);
+
+            auto selected = selector.select(params, options);
+            auto reference = selector.select_exhaustive(params, options);
+
+            ASSERT_EQ(selected.empty(), reference.empty()) << node->id();
+            if (!selected.empty())
+            {
+                EXPECT_EQ(selected[0].kernelName, reference[0].kernelName) << node->id();
+                EXPECT_EQ(selected[0].estimatedTime, reference[0].estimatedTime) << node->id();
+            }
+            layers++;
+        }
+
+        EXPECT_GT(layers, 0);
+    }
+}
+
+TEST(kernel_selection, two_phase_selection_matches_exhaustive_f32_bfyx)
+{
+    compare_selection(data_types::f32, format::bfyx);
+}
+
+TEST(kernel_selection, two_phase_selection_matches_exhaustive_f16_bfyx)
+{
+    compare_selection(data_types::f16, format::bfyx);
+}
+
+TEST(kernel_selection, two_phase_selection_matches_exhaustive_f32_yxfb)
+{
+    compare_selection(data_types::f32, format::yxfb);
+}
@@ -0,0 +1,166 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/network.hpp"
+
+#include "api_impl.h"
+#include "engine_impl.h"
+#include "gpu/ocl_toolkit.h"
+#include "gpu/kernels_cache.h"
+
+#include "test_utils.h"
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace
+{
+    // directory removed with its files when the test ends
+    class temp_directory
+    {
+    public:
+        temp_directory()
+        {
+            const char* tmp = std::getenv("TMPDIR");
+#ifdef _WIN32
+            if (tmp == nullptr)
+                tmp = std::getenv("TEMP");
+            _path = std::string(tmp ? tmp : ".") + "/clDNN_kernels_cache_test_" + std::to_string(_getpid());
+            _mkdir(_path.c_str());
+#else
+            _path = std::string(tmp ? tmp : "/tmp") + "/clDNN_kernels_cache_test_" + std::to_string(getpid());
+            mkdir(_path.c_str(), 0700);
+#endif
+        }
+
+        ~temp_directory()
+        {
+            for (const auto& file : files())
+                std::remove((_path + "/" + file).c_str());
+#ifdef _WIN32
+            _rmdir(_path.c_str());
+#else
+            rmdir(_path.c_str());
+#endif
+        }
+
+        const std::string& path() const { return _path; }
+
+        std::vector<std::string> files() const
+        {
+            std::vector<std::string> result;
+#ifdef _WIN32
+            WIN32_FIND_DATAA data;
+            auto handle = FindFirstFileA((_path + "/*").c_str(), &data);
+            if (handle == INVALID_HANDLE_VALUE)
+                return result;
+            do
+            {
+                if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+                    result.push_back(data.cFileName);
+            } while (FindNextFileA(handle, &data));
+            FindClose(handle);
+#else
+            auto dir = opendir(_path.c_str());
+            if (dir == nullptr)
+                return result;
+            while (auto entry = readdir(dir))
+            {
+                std::string name = entry->d_name;
+                if (name != "." && name != "..")
+                    result.push_back(name);
+            }
+            closedir(dir);
+#endif
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+    private:
+        std::string _path;
+    };
+
+    void execute_abs_network(const engine& engine)
+    {
+        auto input_layout_desc = layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 });
+        auto input = memory::allocate(engine, input_layout_desc);
+        set_values<float>(input, { -1.0f, -2.0f, 3.0f, 4.0f });
+
+        topology topology;
+        topology.add(input_layout("input", input_layout_desc));
+        topology.add(activation("abs", "input", activation_abs));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+
+        auto output = network.execute().at("abs").get_memory().pointer<float>();
+        for (uint32_t i = 0; i < 4; i++)
+            EXPECT_EQ(output[i], float(i + 1));
+    }
+
+    const gpu::kernels_cache& get_kernels_cache(const engine& engine)
+    {
+        return api_cast(engine.get())->get_context()->get_kernels_cache();
+    }
+}
+
+TEST(kernels_cache, binaries_loaded_by_second_engine)
+{
+    temp_directory cache_dir;
+    engine_configuration config(false, false, false, "", "", true, "", "", priority_mode_types::disabled, throttle_mode_types::disabled,
+                                true, nullptr, "cache.json", cache_dir.path());
+
+    std::vector<std::string> stored_files;
+    {
+        engine engine(config);
+        execute_abs_network(engine);
+
+        // empty directory - everything is built from sources and stored
+        EXPECT_EQ(get_kernels_cache(engine).get_binaries_cache_hits(), 0u);
+        EXPECT_GT(get_kernels_cache(engine).get_binaries_cache_misses(), 0u);
+        stored_files = cache_dir.files();
+        EXPECT_EQ(stored_files.size(), get_kernels_cache(engine).get_binaries_cache_misses());
+    }
+
+    {
+        engine engine(config);
+        execute_abs_network(engine);
+
+        // the same programs are loaded from the files, nothing is rebuilt or added
+        EXPECT_GT(get_kernels_cache(engine).get_binaries_cache_hits(), 0u);
+        EXPECT_EQ(get_kernels_cache(engine).get_binaries_cache_misses(), 0u);
+        EXPECT_EQ(cache_dir.files(), stored_files);
+    }
+}
@@ -0,0 +1,154 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "program_impl.h"
+#include "engine_impl.h"
+#include "memory_restrictions.h"
+#include "program_node.h"
+
+#include "test_utils.h"
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace
+{
+    // branches x depth activations, branches are merged pairwise with eltwise at the end of every stage
+    topology make_wide_topology(int branches, int depth, int stages)
+    {
+        topology topology;
+        topology.add(input_layout("input", layout(data_types::f32, format::bfyx, { 1, 1, 4, 4 })));
+        primitive_id stage_input = "input";
+        for (int s = 0; s < stages; ++s)
+        {
+            std::vector<primitive_id> tails;
+            for (int b = 0; b < branches; ++b)
+            {
+                primitive_id prev = stage_input;
+                for (int d = 0; d < depth; ++d)
+                {
+                    auto id = "relu_" + std::to_string(s) + "_" + std::to_string(b) + "_" + std::to_string(d);
+                    topology.add(activation(id, prev, activation_relu));
+                    prev = id;
+                }
+                tails.push_back(prev);
+            }
+            while (tails.size() > 1)
+            {
+                std::vector<primitive_id> merged;
+                for (size_t i = 0; i + 1 < tails.size(); i += 2)
+                {
+                    auto id = "sum_" + tails[i] + "_" + tails[i + 1];
+                    topology.add(eltwise(id, tails[i], tails[i + 1], eltwise_mode::sum));
+                    merged.push_back(id);
+                }
+                if (tails.size() % 2)
+                    merged.push_back(tails.back());
+                tails = merged;
+            }
+            stage_input = tails.front();
+        }
+        return topology;
+    }
+}
+
+TEST(memory_dependencies, wide_network_restrictions)
+{
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    // the deeper activations of every branch and the eltwise merging them run in-place
+    auto topology = make_wide_topology(16, 32, 4);
+    program_impl::ptr prog = api_cast(engine.get())->build_program(*api_cast(topology.get()), build_opt, false);
+
+    auto get_owner = [](program_node* node)
+    {
+        while (node->get_in_place_input() != nullptr)
+            node = node->get_in_place_input();
+        return node;
+    };
+
+    // restrictions have to be symmetric and node can't share buffer with its inputs,
+    // owners of the buffers of in-place primitives get the restrictions of the aliases
+    size_t aliases = 0;
+    for (auto node : prog->get_processing_order())
+    {
+        if (node->get_in_place_input() != nullptr)
+            ++aliases;
+
+        for (auto dep : node->get_dependencies())
+        {
+            if (dep->can_be_optimized() || node->can_be_optimized())
+                continue;
+            const auto& node_restrictions = node->get_memory_restrictions();
+            const auto& dep_restrictions = dep->get_memory_restrictions();
+            EXPECT_TRUE(node_restrictions.contains(dep->get_memory_index())) << node->id() << " - " << dep->id();
+            EXPECT_TRUE(dep_restrictions.contains(node->get_memory_index())) << dep->id() << " - " << node->id();
+
+            auto node_owner = get_owner(node);
+            auto dep_owner = get_owner(dep);
+            if (node_owner == dep_owner)
+                continue;
+            EXPECT_TRUE(node_owner->get_memory_restrictions().contains(dep_owner->get_memory_index())) << node->id() << " - " << dep->id();
+            EXPECT_TRUE(dep_owner->get_memory_restrictions().contains(node_owner->get_memory_index())) << dep->id() << " - " << node->id();
+        }
+    }
+    EXPECT_GT(aliases, size_t(16 * 30 * 4));
+
+    // the tail of one of the first two branches is alive while the other branch runs, so their owners can't share a buffer
+    for (int s = 0; s < 4; ++s)
+    {
+        auto& first = prog->get_node("relu_" + std::to_string(s) + "_0_0");
+        auto& second = prog->get_node("relu_" + std::to_string(s) + "_1_0");
+        ASSERT_EQ(get_owner(&prog->get_node("relu_" + std::to_string(s) + "_0_31")), &first) << s;
+        ASSERT_EQ(get_owner(&prog->get_node("relu_" + std::to_string(s) + "_1_31")), &second) << s;
+        EXPECT_TRUE(first.get_memory_restrictions().contains(second.get_memory_index())) << s;
+        EXPECT_TRUE(second.get_memory_restrictions().contains(first.get_memory_index())) << s;
+    }
+}
+
+TEST(memory_dependencies, long_in_place_chain)
+{
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    // every activation but the first and the output one runs in-place, so all of them share the buffer of the first
+    const int depth = 64;
+    auto topology = make_wide_topology(1, depth, 1);
+    program_impl::ptr prog = api_cast(engine.get())->build_program(*api_cast(topology.get()), build_opt, false);
+
+    auto relu = [&prog](int d) -> program_node& { return prog->get_node("relu_0_0_" + std::to_string(d)); };
+    auto& owner = relu(0);
+    auto& output = relu(depth - 1);
+    for (int d = 1; d < depth - 1; ++d)
+        ASSERT_EQ(relu(d).get_in_place_input(), &relu(d - 1)) << d;
+    EXPECT_EQ(output.get_in_place_input(), nullptr);
+
+    // the output reads the last alias, so it can't share the buffer with the owner
+    EXPECT_FALSE(owner.get_memory_restrictions().contains(owner.get_memory_index()));
+    EXPECT_TRUE(owner.get_memory_restrictions().contains(output.get_memory_index()));
+    EXPECT_TRUE(output.get_memory_restrictions().contains(owner.get_memory_index()));
+}
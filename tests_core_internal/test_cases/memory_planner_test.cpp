@@ -0,0 +1,115 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "memory_pool.h"
+
+using namespace cldnn;
+
+namespace
+{
+    void add_conflict(std::vector<memory_plan_request>& requests, size_t a, size_t b)
+    {
+        requests[a]._conflicts.push_back(b);
+        requests[b]._conflicts.push_back(a);
+    }
+
+    bool overlap(const memory_plan::placement& a, const memory_plan::placement& b)
+    {
+        return a._arena == b._arena && a._offset < b._offset + b._size && b._offset < a._offset + a._size;
+    }
+}
+
+TEST(memory_planner, chain_reuses_two_slots)
+{
+    // a -> b -> c -> d -> e, each buffer conflicts only with its neighbours
+    std::vector<memory_plan_request> requests;
+    for (auto id : { "a", "b", "c", "d", "e" })
+        requests.emplace_back(id, 1000);
+    for (size_t i = 0; i + 1 < requests.size(); ++i)
+        add_conflict(requests, i, i + 1);
+
+    auto plan = memory_pool::make_memory_plan(requests, 128, 1 << 20);
+
+    EXPECT_EQ(plan._naive_size, 5000u);
+    EXPECT_EQ(plan._arenas.size(), 1u);
+    EXPECT_EQ(plan.get_planned_size(), 1024u + 1000u);
+}
+
+TEST(memory_planner, conflicting_buffers_dont_overlap)
+{
+    std::vector<memory_plan_request> requests;
+    uint64_t sizes[] = { 300, 5000, 64, 4096, 1000, 200, 4096, 10 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        requests.emplace_back("prim" + std::to_string(i), sizes[i]);
+    add_conflict(requests, 0, 1);
+    add_conflict(requests, 1, 2);
+    add_conflict(requests, 1, 3);
+    add_conflict(requests, 3, 4);
+    add_conflict(requests, 3, 5);
+    add_conflict(requests, 4, 5);
+    add_conflict(requests, 5, 6);
+    add_conflict(requests, 6, 7);
+    add_conflict(requests, 0, 7);
+
+    auto plan = memory_pool::make_memory_plan(requests, 64, 1 << 20);
+
+    ASSERT_EQ(plan._placements.size(), requests.size());
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        EXPECT_EQ(plan._placements[i]._offset % 64, 0u);
+        EXPECT_LE(plan._placements[i]._offset + plan._placements[i]._size, plan._arenas[plan._placements[i]._arena]);
+        for (auto conflict : requests[i]._conflicts)
+            EXPECT_FALSE(overlap(plan._placements[i], plan._placements[conflict])) << i << " overlaps " << conflict;
+    }
+    EXPECT_LT(plan.get_planned_size(), plan._naive_size);
+}
+
+TEST(memory_planner, arena_size_limit)
+{
+    std::vector<memory_plan_request> requests;
+    requests.emplace_back("a", 600);
+    requests.emplace_back("b", 600);
+    requests.emplace_back("c", 300);
+    add_conflict(requests, 0, 1);
+    add_conflict(requests, 0, 2);
+    add_conflict(requests, 1, 2);
+
+    auto plan = memory_pool::make_memory_plan(requests, 1, 1000);
+
+    EXPECT_EQ(plan._arenas.size(), 2u);
+    for (auto arena : plan._arenas)
+        EXPECT_LE(arena, 1000u);
+    EXPECT_EQ(plan.get_planned_size(), 1500u);
+}
+
+TEST(memory_planner, oversized_requests_are_not_planned)
+{
+    std::vector<memory_plan_request> requests;
+    requests.emplace_back("a", 600);
+    requests.emplace_back("huge", 1500);
+    requests.emplace_back("b", 600);
+    add_conflict(requests, 0, 1);
+    add_conflict(requests, 1, 2);
+
+    auto plan = memory_pool::make_memory_plan(requests, 1, 1000);
+
+    EXPECT_EQ(plan._placements[1]._arena, memory_plan::unplanned);
+    EXPECT_EQ(plan._naive_size, 1200u);
+    EXPECT_EQ(plan._arenas.size(), 1u);
+    EXPECT_EQ(plan.get_planned_size(), 600u);
+}
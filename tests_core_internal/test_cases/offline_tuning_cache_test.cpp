@@ -0,0 +1,74 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "auto_tuner.h"
+#include "offline_tuning_cache.h"
+#include "istreamwrapper.h"
+
+using namespace kernel_selector;
+
+// cache.bin is generated from cache.json by tuning_cache_gen.py when the kernel selector is built,
+// paths of both files are set in CMakeLists.txt
+TEST(offline_tuning_cache, binary_cache_matches_json)
+{
+    std::ifstream json_file(CLDNN_TEST_TUNING_CACHE_JSON);
+    ASSERT_TRUE(json_file.good());
+    rapidjson::IStreamWrapper isw{ json_file };
+    rapidjson::Document json_cache;
+    json_cache.ParseStream(isw);
+    ASSERT_FALSE(json_cache.HasParseError());
+    ASSERT_TRUE(json_cache.IsObject());
+
+    AutoTuner tuner;
+    size_t sections = 0;
+    for (auto section = json_cache.MemberBegin(); section != json_cache.MemberEnd(); ++section, ++sections)
+    {
+        const auto compute_units = static_cast<uint32_t>(std::stoul(section->name.GetString()));
+        auto binary_cache = OfflineTuningCache::Open(CLDNN_TEST_TUNING_CACHE_BIN, compute_units);
+        ASSERT_NE(binary_cache, nullptr) << "section " << compute_units;
+
+        // some hashes are repeated in cache.json, the binary cache keeps the one found by the json lookup
+        std::set<std::string> hashes;
+        for (auto entry = section->value.MemberBegin(); entry != section->value.MemberEnd(); ++entry)
+            hashes.insert(entry->name.GetString());
+        EXPECT_EQ(binary_cache->Size(), hashes.size()) << "section " << compute_units;
+
+        // the same device section as passed to the kernel selector in engineInfo.deviceCache
+        auto device_cache = std::make_shared<rapidjson::Document>();
+        device_cache->CopyFrom(section->value, device_cache->GetAllocator());
+
+        for (auto entry = section->value.MemberBegin(); entry != section->value.MemberEnd(); ++entry)
+        {
+            const std::string hash = entry->name.GetString();
+            auto from_json = tuner.LoadKernelOffline(device_cache, hash);
+            auto from_binary = tuner.LoadKernelOffline(*binary_cache, std::stoull(hash));
+            ASSERT_FALSE(std::get<0>(from_json).empty()) << "section " << compute_units << " hash " << hash;
+            ASSERT_EQ(from_json, from_binary) << "section " << compute_units << " hash " << hash;
+        }
+
+        // hashes which are not in the cache are misses in both
+        EXPECT_EQ(tuner.LoadKernelOffline(device_cache, "1"), tuner.LoadKernelOffline(*binary_cache, 1));
+        EXPECT_TRUE(std::get<0>(tuner.LoadKernelOffline(*binary_cache, 1)).empty());
+    }
+    EXPECT_GT(sections, 0u);
+}
@@ -0,0 +1,103 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "queue_scheduler.h"
+
+using namespace cldnn;
+
+TEST(queue_scheduler, chain_stays_on_one_queue)
+{
+    // a -> b -> c -> d
+    std::vector<queue_schedule_request> requests;
+    requests.emplace_back(10);
+    for (size_t i = 1; i < 4; ++i)
+        requests.emplace_back(10, std::vector<size_t>{ i - 1 });
+
+    auto schedule = make_queue_schedule(requests, 4, 5);
+
+    EXPECT_EQ(schedule._queues, std::vector<uint16_t>(4, 0));
+    EXPECT_EQ(schedule._cross_queue_waits, 0u);
+    EXPECT_EQ(schedule._makespan, 40u);
+    EXPECT_EQ(schedule._serial_time, 40u);
+}
+
+TEST(queue_scheduler, branches_run_concurrently)
+{
+    // root -> 4 independent branches of two steps -> join
+    std::vector<queue_schedule_request> requests;
+    requests.emplace_back(1);
+    std::vector<size_t> branch_ends;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        requests.emplace_back(10, std::vector<size_t>{ 0 });
+        requests.emplace_back(10, std::vector<size_t>{ requests.size() - 1 });
+        branch_ends.push_back(requests.size() - 1);
+    }
+    requests.emplace_back(1, branch_ends);
+
+    auto single = make_queue_schedule(requests, 1, 2);
+    EXPECT_EQ(single._makespan, single._serial_time);
+    EXPECT_EQ(single._cross_queue_waits, 0u);
+
+    auto two = make_queue_schedule(requests, 2, 2);
+    auto four = make_queue_schedule(requests, 4, 2);
+    EXPECT_LT(two._makespan, single._makespan);
+    EXPECT_LT(four._makespan, two._makespan);
+
+    // both steps of every branch run on the same queue, only forks and joins are synchronized
+    for (size_t i = 1; i < branch_ends.back(); i += 2)
+        EXPECT_EQ(four._queues[i], four._queues[i + 1]);
+    EXPECT_LE(four._cross_queue_waits, 6u);
+
+    // more queues than branches don't help
+    EXPECT_EQ(make_queue_schedule(requests, 8, 2)._makespan, four._makespan);
+}
+
+TEST(queue_scheduler, critical_path_keeps_its_queue)
+{
+    // root -> short, root -> long1 -> long2, short comes first in processing order
+    std::vector<queue_schedule_request> requests;
+    requests.emplace_back(1);
+    requests.emplace_back(1, std::vector<size_t>{ 0 });
+    requests.emplace_back(10, std::vector<size_t>{ 0 });
+    requests.emplace_back(10, std::vector<size_t>{ 2 });
+
+    auto schedule = make_queue_schedule(requests, 2, 1);
+
+    EXPECT_EQ(schedule._queues[2], schedule._queues[0]);
+    EXPECT_EQ(schedule._queues[3], schedule._queues[0]);
+    EXPECT_NE(schedule._queues[1], schedule._queues[0]);
+    EXPECT_EQ(schedule._cross_queue_waits, 1u);
+    EXPECT_EQ(schedule._makespan, 21u);
+}
+
+TEST(queue_scheduler, simulation_counts_synchronization)
+{
+    // a -> b on different queues, b waits for a through event
+    std::vector<queue_schedule_request> requests;
+    requests.emplace_back(3);
+    requests.emplace_back(4, std::vector<size_t>{ 0 });
+
+    auto schedule = simulate_queue_schedule(requests, { 0, 1 }, 5);
+    EXPECT_EQ(schedule._makespan, 12u);
+    EXPECT_EQ(schedule._cross_queue_waits, 1u);
+
+    EXPECT_THROW(simulate_queue_schedule(requests, { 0 }, 5), std::invalid_argument);
+    requests[0]._deps.push_back(1);
+    EXPECT_THROW(make_queue_schedule(requests, 2, 5), std::invalid_argument);
+}
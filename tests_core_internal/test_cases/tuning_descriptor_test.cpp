@@ -0,0 +1,91 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "auto_tuner.h"
+#include "convolution/convolution_params.h"
+
+using namespace kernel_selector;
+
+namespace
+{
+    TuningDescriptor conv_descriptor(size_t size, size_t features, DataLayout layout = DataLayout::bfyx, size_t stride = 1)
+    {
+        convolution_params params;
+        params.inputs[0] = DataTensor({ size, size, features, 1 }, Datatype::F32, layout);
+        params.output = DataTensor({ size / stride, size / stride, features, 1 }, Datatype::F32, layout);
+        params.filterSize = { 3, 3, 1 };
+        params.stride = { static_cast<uint32_t>(stride), static_cast<uint32_t>(stride), 1 };
+        params.engineInfo.computeUnitsCount = 24;
+        return TuningDescriptor::FromParams(params);
+    }
+}
+
+TEST(tuning_descriptor, only_sizes_may_differ)
+{
+    auto descriptor = conv_descriptor(56, 64);
+    EXPECT_TRUE(descriptor.Compatible(conv_descriptor(60, 64)));
+    EXPECT_TRUE(descriptor.Compatible(conv_descriptor(28, 128)));
+    EXPECT_FALSE(descriptor.Compatible(conv_descriptor(56, 64, DataLayout::yxfb)));
+    EXPECT_FALSE(descriptor.Compatible(conv_descriptor(56, 64, DataLayout::bfyx, 2)));
+    EXPECT_FALSE(descriptor.Compatible(TuningDescriptor()));
+
+    EXPECT_EQ(descriptor.Distance(descriptor), 0.f);
+    EXPECT_LT(descriptor.Distance(conv_descriptor(60, 64)), descriptor.Distance(conv_descriptor(28, 128)));
+}
+
+TEST(tuning_descriptor, nearest_kernels_from_online_cache)
+{
+    const std::string cache_path = "tuning_descriptor_test.json";
+    std::remove(cache_path.c_str());
+    {
+        AutoTuner tuner;
+        tuner.StoreKernel(cache_path, "1", "kernel_a", 1, 24, TuningStatistics(), conv_descriptor(56, 64));
+        tuner.StoreKernel(cache_path, "2", "kernel_b", 2, 24, TuningStatistics(), conv_descriptor(28, 128));
+        tuner.StoreKernel(cache_path, "3", "kernel_c", 3, 24, TuningStatistics(), conv_descriptor(60, 64, DataLayout::yxfb));
+        tuner.StoreKernel(cache_path, "4", "kernel_d", 4, 24);
+        tuner.StoreKernel(cache_path, "5", "kernel_a", 1, 24, TuningStatistics(), conv_descriptor(50, 64));
+    }
+
+    // descriptors are read back from the file written by the first tuner
+    AutoTuner tuner;
+    auto nearest = tuner.LoadNearestKernelsOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, conv_descriptor(64, 64), 4);
+    ASSERT_EQ(nearest.size(), 2u);
+    EXPECT_EQ(nearest[0], std::make_tuple(std::string("kernel_a"), 1));
+    EXPECT_EQ(nearest[1], std::make_tuple(std::string("kernel_b"), 2));
+
+    EXPECT_EQ(tuner.LoadNearestKernelsOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, conv_descriptor(64, 64), 1).size(), 1u);
+    EXPECT_TRUE(tuner.LoadNearestKernelsOnline(TuningMode::TUNING_USE_CACHE, cache_path, 12, conv_descriptor(64, 64), 4).empty());
+    EXPECT_EQ(std::get<0>(tuner.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, cache_path, 24, "4")), "kernel_d");
+    std::remove(cache_path.c_str());
+}
+
+TEST(tuning_descriptor, lookup_statistics)
+{
+    AutoTuner tuner;
+    tuner.CountLookup(AutoTuner::LookupResult::EXACT_HIT);
+    tuner.CountLookup(AutoTuner::LookupResult::NEAREST_HIT);
+    tuner.CountLookup(AutoTuner::LookupResult::NEAREST_HIT);
+    tuner.CountLookup(AutoTuner::LookupResult::MISS);
+
+    auto statistics = tuner.GetLookupStatistics();
+    EXPECT_EQ(statistics.exactHits, 1u);
+    EXPECT_EQ(statistics.nearestHits, 2u);
+    EXPECT_EQ(statistics.misses, 1u);
+}
@@ -0,0 +1,155 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "tuning_search.h"
+
+using namespace kernel_selector;
+
+namespace
+{
+    // candidate i runs in run_times[i] ns with multiplicative noise, every outlier_period-th run is 10x slower
+    // and the first run of each kernel is 3x slower (cold caches); negative time means the kernel fails to run
+    class mock_kernel_runner : public KernelRunnerInterface
+    {
+    public:
+        mock_kernel_runner(std::vector<int64_t> run_times, double noise, int outlier_period = 0)
+            : run_times(std::move(run_times)), noise(noise), outlier_period(outlier_period), engine(7)
+        {
+        }
+
+        std::vector<uint64_t> run_kernels(const KernelsData& kernels_data) override
+        {
+            std::vector<uint64_t> result;
+            for (const auto& kd : kernels_data)
+                result.push_back(run(kd.autoTuneIndex));
+            return result;
+        }
+
+        std::vector<std::vector<uint64_t>> run_kernels_samples(const KernelsData& kernels_data, int warmup_runs, int timed_runs) override
+        {
+            std::vector<std::vector<uint64_t>> result;
+            for (const auto& kd : kernels_data)
+            {
+                for (int i = 0; i < warmup_runs; i++)
+                    run(kd.autoTuneIndex);
+                std::vector<uint64_t> samples;
+                for (int i = 0; i < timed_runs; i++)
+                {
+                    auto time = run(kd.autoTuneIndex);
+                    if (time != std::numeric_limits<uint64_t>::max())
+                        samples.push_back(time);
+                }
+                result.push_back(samples);
+            }
+            return result;
+        }
+
+        size_t total_runs = 0;
+
+    private:
+        uint64_t run(int idx)
+        {
+            total_runs++;
+            if (run_times[idx] < 0)
+                return std::numeric_limits<uint64_t>::max();
+
+            double time = static_cast<double>(run_times[idx]) * std::uniform_real_distribution<double>(1.0 - noise, 1.0 + noise)(engine);
+            if (runs_per_kernel[idx]++ == 0)
+                time *= 3;
+            else if (outlier_period && runs_per_kernel[idx] % outlier_period == 0)
+                time *= 10;
+            return static_cast<uint64_t>(time);
+        }
+
+        std::vector<int64_t> run_times;
+        double noise;
+        int outlier_period;
+        std::mt19937 engine;
+        std::map<int, int> runs_per_kernel;
+    };
+
+    KernelsData make_candidates(size_t count)
+    {
+        KernelsData candidates(count);
+        for (size_t i = 0; i < count; i++)
+            candidates[i].autoTuneIndex = static_cast<int>(i);
+        return candidates;
+    }
+}
+
+TEST(tuning_search, statistics_from_samples)
+{
+    auto stats = TuningStatistics::FromSamples({ 50, 10, 30, 20, 40, std::numeric_limits<uint64_t>::max() });
+    EXPECT_EQ(stats.runs, 5u);
+    EXPECT_EQ(stats.median, 30u);
+    EXPECT_LE(stats.lowerBound, stats.median);
+    EXPECT_GE(stats.upperBound, stats.median);
+
+    auto empty = TuningStatistics::FromSamples({});
+    EXPECT_EQ(empty.runs, 0u);
+    EXPECT_EQ(empty.median, std::numeric_limits<uint64_t>::max());
+}
+
+TEST(tuning_search, picks_fastest_despite_cold_runs_and_outliers)
+{
+    // 200 candidates, the fastest one is close to the runner-up
+    std::vector<int64_t> run_times;
+    for (int i = 0; i < 200; i++)
+        run_times.push_back(1000 + 37 * ((i * 71) % 200));
+    run_times[123] = 950;
+
+    mock_kernel_runner runner(run_times, 0.02, 4);
+    auto result = TuningSearch().Run(runner, make_candidates(run_times.size()));
+
+    ASSERT_EQ(result.index, 123u);
+    EXPECT_GT(result.statistics.runs, 3u);
+    EXPECT_LT(result.statistics.median, 1000u);
+
+    // exhaustive measurement with the same number of warmup and timed runs per candidate as the finalist got
+    const size_t exhaustive_runs = run_times.size() * (1 + result.statistics.runs);
+    EXPECT_LT(runner.total_runs * 2, exhaustive_runs);
+}
+
+TEST(tuning_search, separated_winner_stops_early)
+{
+    std::vector<int64_t> run_times(64, 10000);
+    run_times[5] = 100;
+
+    mock_kernel_runner runner(run_times, 0.01);
+    auto result = TuningSearch().Run(runner, make_candidates(run_times.size()));
+
+    ASSERT_EQ(result.index, 5u);
+    // warmup and a single round of measurements
+    EXPECT_EQ(runner.total_runs, run_times.size() * 4);
+}
+
+TEST(tuning_search, failing_kernels_are_skipped)
+{
+    mock_kernel_runner runner({ -1, 300, -1, 200, 400 }, 0.01);
+    auto result = TuningSearch().Run(runner, make_candidates(5));
+    ASSERT_EQ(result.index, 3u);
+    EXPECT_EQ(result.candidates[0].runs, 0u);
+    EXPECT_EQ(result.candidates[2].runs, 0u);
+
+    mock_kernel_runner failing_runner({ -1, -1 }, 0.01);
+    EXPECT_EQ(TuningSearch().Run(failing_runner, make_candidates(2)).index, TuningSearch::Result::none);
+    EXPECT_EQ(TuningSearch().Run(failing_runner, {}).index, TuningSearch::Result::none);
+}